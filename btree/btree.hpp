@@ -0,0 +1,869 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef BTREE_BTREE_HPP_
+#define BTREE_BTREE_HPP_
+
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "../type_traits/type_traits.hpp"
+#include "../utility/pair.hpp"
+#include "./btree_node.hpp"
+#include "../iterators/reverse_iter.hpp"
+#include "../iterators/btree_iter.hpp"
+
+namespace ft {
+
+/**
+ * B-tree behind ft::btree_map and ft::btree_set. Each node keeps a sorted
+ * run of values sized to a few cache lines, so a lookup binary-searches
+ * contiguous keys and follows one pointer per level of a much shallower
+ * tree than rb_tree's. Values move between nodes as they split and merge:
+ * unlike rb_tree, inserting or erasing invalidates every iterator.
+ *
+ * An insertion whose copy or allocation throws leaves the tree as it was.
+ * Erasing moves values byte for byte when value_type is trivially
+ * relocatable; otherwise it copies them, and those copies must not throw.
+ */
+template <typename key_type,
+          typename value_type,
+          typename KeyOfValue,
+          typename Compare,
+          typename AllocTp = std::allocator<value_type> >
+class btree {
+ public:
+    typedef btree_node<value_type>                      node_base;
+    typedef btree_internal_node<value_type>             internal_node;
+    typedef node_base*                                  node_pointer;
+    typedef const node_base*                            const_node_pointer;
+
+ private:
+    typedef typename AllocTp::template
+                    rebind<node_base>::other            leaf_allocator;
+    typedef typename AllocTp::template
+                    rebind<internal_node>::other        internal_allocator;
+
+ public:
+    typedef size_t                                      size_type;
+    typedef ptrdiff_t                                   difference_type;
+    typedef value_type&                                 reference;
+    typedef const value_type&                           const_reference;
+    typedef value_type*                                 pointer;
+    typedef const value_type*                           const_pointer;
+    typedef Compare                                     key_compare;
+
+    typedef ft::btree_iter<pointer, node_base>          iterator;
+    typedef ft::btree_iter<const_pointer, node_base>    const_iterator;
+    typedef ft::reverse_iter<iterator>                  reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>            const_reverse_iterator;
+
+    explicit btree(const key_compare& comp,
+                   const AllocTp& allocator = AllocTp())
+            :   _size(0),
+                _comp(comp),
+                _value_allocator(allocator),
+                _leaf_allocator(allocator),
+                _internal_allocator(allocator),
+                _root(0),
+                _leftmost(0),
+                _rightmost(0) {}
+
+    btree(const btree& src)
+            :   _size(0),
+                _comp(src._comp),
+                _value_allocator(src._value_allocator),
+                _leaf_allocator(src._leaf_allocator),
+                _internal_allocator(src._internal_allocator),
+                _root(0),
+                _leftmost(0),
+                _rightmost(0) {
+        *this = src;
+    }
+
+    ~btree() { clear(); }
+
+    /* Clones src node for node, with no comparison and no rebalancing. */
+    btree&      operator=(const btree& src) {
+        if (&src == this) {
+            return *this;
+        }
+        clear();
+        _comp = src._comp;
+        if (src._size) {
+            _root = _clone(src._root);
+            _leftmost = node_base::leftmost_leaf(_root);
+            _rightmost = node_base::rightmost_leaf(_root);
+            _size = src._size;
+        }
+        return *this;
+    }
+
+    void swap(btree& src) {
+        _swap(_size, src._size);
+        _swap(_comp, src._comp);
+        _swap(_value_allocator, src._value_allocator);
+        _swap(_leaf_allocator, src._leaf_allocator);
+        _swap(_internal_allocator, src._internal_allocator);
+        _swap(_root, src._root);
+        _swap(_leftmost, src._leftmost);
+        _swap(_rightmost, src._rightmost);
+    }
+
+    size_type   size(void) const {
+        return _size;
+    }
+
+    size_type   max_size(void) const {
+        return _value_allocator.max_size();
+    }
+
+    AllocTp     get_allocator(void) const {
+        return _value_allocator;
+    }
+
+    iterator        begin(void) {
+        return iterator(_leftmost, 0);
+    }
+
+    const_iterator  begin(void) const {
+        return const_iterator(_leftmost, 0);
+    }
+
+    iterator        end(void) {
+        return iterator(_rightmost, _rightmost ? _rightmost->count : 0);
+    }
+
+    const_iterator  end(void) const {
+        return const_iterator(_rightmost, _rightmost ? _rightmost->count : 0);
+    }
+
+    /**
+     * Lookups return a mutable iterator even on a const tree; the
+     * containers hand it out as a const_iterator where they have to.
+     */
+
+    template <typename K>
+    iterator    find(const K& key) const {
+        for (const_node_pointer x = _root; x; ) {
+            size_type   i = _lower_slot(x, key);
+
+            if (i < x->count && !_comp(key, _key(x, i))) {
+                return iterator(x, i);
+            }
+            if (x->leaf) {
+                break;
+            }
+            x = x->child(i);
+        }
+        return _end();
+    }
+
+    /**
+     * The last slot holding a key not less than key on the way down is
+     * the bound: anything found deeper lies before it.
+     */
+    template <typename K>
+    iterator    lower_bound(const K& key) const {
+        iterator    bound = _end();
+
+        for (const_node_pointer x = _root; x; ) {
+            size_type   i = _lower_slot(x, key);
+
+            if (i < x->count) {
+                bound = iterator(x, i);
+            }
+            if (x->leaf) {
+                break;
+            }
+            x = x->child(i);
+        }
+        return bound;
+    }
+
+    template <typename K>
+    iterator    upper_bound(const K& key) const {
+        iterator    bound = _end();
+
+        for (const_node_pointer x = _root; x; ) {
+            size_type   i = _upper_slot(x, key);
+
+            if (i < x->count) {
+                bound = iterator(x, i);
+            }
+            if (x->leaf) {
+                break;
+            }
+            x = x->child(i);
+        }
+        return bound;
+    }
+
+    ft::pair<iterator, bool>    insert_unique(const value_type& value) {
+        const key_type& key = KeyOfValue()(value);
+        size_type       i = 0;
+
+        if (!_root) {
+            _root = _leftmost = _rightmost = _create_node(true);
+        }
+        node_pointer    x = _root;
+        for (;;) {
+            i = _lower_slot(x, key);
+            if (i < x->count && !_comp(key, _key(x, i))) {
+                return ft::make_pair(iterator(x, i), false);
+            }
+            if (x->leaf) {
+                break;
+            }
+            x = x->child(i);
+        }
+        iterator    inserted = _insert_at(x, i, value);
+
+        ++_size;
+        return ft::make_pair(inserted, true);
+    }
+
+    /**
+     * When value belongs right before hint, it goes straight into the leaf
+     * slot there, or after hint's predecessor when hint is in an internal
+     * node; appending sorted input at end() never searches.
+     */
+    iterator    insert_unique(iterator hint, const value_type& value) {
+        const key_type& key = KeyOfValue()(value);
+
+        if (_size) {
+            iterator    before = hint;
+
+            if ((hint == begin() || _comp(KeyOfValue()(*--before), key))
+                && (hint == end() || _comp(key, KeyOfValue()(*hint)))) {
+                node_pointer    x = hint.base();
+                size_type       i = hint.position();
+
+                if (!x->leaf) {
+                    x = before.base();
+                    i = before.position() + 1;
+                }
+                iterator    inserted = _insert_at(x, i, value);
+
+                ++_size;
+                return inserted;
+            }
+        }
+        return insert_unique(value).first;
+    }
+
+    template <typename InputIt>
+    void    insert_range(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert_unique(end(), *first);
+        }
+    }
+
+    void    erase(iterator pos) {
+        _erase_at(pos.base(), pos.position());
+    }
+
+    /**
+     * Erasing invalidates iterators, so the range is walked by key: each
+     * step erases the first element and finds its successor again.
+     */
+    void    erase(iterator first, iterator last) {
+        if (first == begin() && last == end()) {
+            clear();
+            return;
+        }
+        size_type   n = 0;
+
+        for (iterator it = first; it != last; ++it) {
+            ++n;
+        }
+        while (n--) {
+            key_type    key(KeyOfValue()(*first));
+
+            _erase_at(first.base(), first.position());
+            first = lower_bound(key);
+        }
+    }
+
+    size_type   remove(const key_type& key) {
+        iterator    pos = find(key);
+
+        if (pos == end()) {
+            return 0;
+        }
+        erase(pos);
+        return 1;
+    }
+
+    void    clear(void) {
+        _destroy_subtree(_root);
+        _root = _leftmost = _rightmost = 0;
+        _size = 0;
+    }
+
+ private:
+    size_type           _size;
+    key_compare         _comp;
+    AllocTp             _value_allocator;
+    leaf_allocator      _leaf_allocator;
+    internal_allocator  _internal_allocator;
+    node_pointer        _root;
+    node_pointer        _leftmost;
+    node_pointer        _rightmost;
+
+    template <typename U>
+    static void     _swap(U& x, U& y) {
+        U   tmp(x);
+
+        x = y;
+        y = tmp;
+    }
+
+    iterator    _end(void) const {
+        return iterator(_rightmost, _rightmost ? _rightmost->count : 0);
+    }
+
+    const key_type& _key(const_node_pointer x, size_type i) const {
+        return KeyOfValue()(x->value(i));
+    }
+
+    /* The first slot of x whose key is not less than key. */
+    template <typename K>
+    size_type   _lower_slot(const_node_pointer x, const K& key) const {
+        size_type   low = 0;
+        size_type   high = x->count;
+
+        while (low < high) {
+            size_type   middle = (low + high) / 2;
+
+            if (_comp(_key(x, middle), key)) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    /* The first slot of x whose key is greater than key. */
+    template <typename K>
+    size_type   _upper_slot(const_node_pointer x, const K& key) const {
+        size_type   low = 0;
+        size_type   high = x->count;
+
+        while (low < high) {
+            size_type   middle = (low + high) / 2;
+
+            if (_comp(key, _key(x, middle))) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        return low;
+    }
+
+    /*                      Node management                     */
+
+    node_pointer    _create_node(bool leaf) {
+        if (leaf) {
+            node_pointer    x = _leaf_allocator.allocate(1);
+
+            return ::new (static_cast<void*>(x)) node_base(true);
+        }
+        internal_node*  x = _internal_allocator.allocate(1);
+
+        return ::new (static_cast<void*>(x)) internal_node();
+    }
+
+    /* Frees x itself; its values must already be destroyed or moved. */
+    void    _free_node(node_pointer x) {
+        if (x->leaf) {
+            _leaf_allocator.deallocate(x, 1);
+        } else {
+            _internal_allocator.deallocate(static_cast<internal_node*>(x), 1);
+        }
+    }
+
+    /* Internal nodes being cloned may still have null children. */
+    void    _destroy_subtree(node_pointer x) {
+        if (!x) {
+            return;
+        }
+        for (size_type i = 0; i < x->count; ++i) {
+            _value_allocator.destroy(&x->value(i));
+        }
+        if (!x->leaf) {
+            for (size_type i = 0; i <= x->count; ++i) {
+                _destroy_subtree(x->child(i));
+            }
+        }
+        _free_node(x);
+    }
+
+    node_pointer    _clone(const_node_pointer src) {
+        node_pointer    x = _create_node(src->leaf);
+
+        try {
+            for (; x->count < src->count; ++x->count) {
+                _value_allocator.construct(&x->value(x->count),
+                                           src->value(x->count));
+            }
+            for (size_type i = 0; !x->leaf && i <= x->count; ++i) {
+                _set_child(x, i, _clone(src->child(i)));
+            }
+        } catch (...) {
+            _destroy_subtree(x);
+            throw;
+        }
+        return x;
+    }
+
+    static void     _set_child(node_pointer x, size_type i, node_pointer y) {
+        x->child(i) = y;
+        y->parent = x;
+        y->position = static_cast<unsigned short>(i);
+    }
+
+    /**
+     * Moves the value in slot j of y into the empty slot i of x. Values
+     * that relocate byte for byte are memcpy'd, which cannot throw; any
+     * other one is copied, then destroyed.
+     */
+    void    _move_value(node_pointer x, size_type i,
+                        node_pointer y, size_type j) {
+        _relocate(&x->value(i), &y->value(j));
+    }
+
+    void    _relocate(pointer dest, pointer src) {
+        if (is_trivially_relocatable<value_type>::value) {
+            std::memcpy(static_cast<void*>(dest), static_cast<void*>(src),
+                        sizeof(value_type));
+        } else {
+            _value_allocator.construct(dest, *src);
+            _value_allocator.destroy(src);
+        }
+    }
+
+    /* Destroys the values of a node the tree does not link to, then x. */
+    void    _discard(node_pointer x) {
+        for (size_type i = 0; i < x->count; ++i) {
+            _value_allocator.destroy(&x->value(i));
+        }
+        _free_node(x);
+    }
+
+    /*                          Insertion                       */
+
+    /**
+     * Puts a copy of value in slot i of the leaf x. If copying value, or
+     * allocating a node, throws, the tree is left as it was.
+     */
+    iterator    _insert_at(node_pointer x, size_type i,
+                           const value_type& value) {
+        if (is_trivially_relocatable<value_type>::value) {
+            return _insert_relocating(x, i, value);
+        }
+        return _insert_copying(x, i, value, 0, 0);
+    }
+
+    /**
+     * Values that relocate byte for byte are copied once into a buffer,
+     * with every node the splits need allocated beforehand: from then on,
+     * shifting them in place cannot throw.
+     */
+    iterator    _insert_relocating(node_pointer x, size_type i,
+                                   const value_type& value) {
+        node_pointer    spares = _reserve_splits(x);
+        union {
+            char        bytes[sizeof(value_type)];
+            long double align_long_double;
+            long        align_long;
+            void*       align_pointer;
+        }               buffer;
+        pointer         copy = reinterpret_cast<pointer>(buffer.bytes);
+
+        try {
+            _value_allocator.construct(copy, value);
+        } catch (...) {
+            _free_spares(spares);
+            throw;
+        }
+        return _place(x, i, copy, 0, spares);
+    }
+
+    /**
+     * A sibling for x and for each full parent above it, in the order the
+     * splits take them, and a new root if the splits reach the root. They
+     * are chained through their parent field.
+     */
+    node_pointer    _reserve_splits(node_pointer x) {
+        node_pointer    spares = 0;
+        node_pointer*   last = &spares;
+
+        try {
+            for (; x && x->count == node_base::slots; x = x->parent) {
+                *last = _create_node(x->leaf);
+                last = &(*last)->parent;
+            }
+            if (!x) {
+                *last = _create_node(false);
+            }
+        } catch (...) {
+            _free_spares(spares);
+            throw;
+        }
+        return spares;
+    }
+
+    node_pointer    _pop_spare(node_pointer& spares) {
+        node_pointer    x = spares;
+
+        spares = x->parent;
+        x->parent = 0;
+        return x;
+    }
+
+    void    _free_spares(node_pointer spares) {
+        while (spares) {
+            _free_node(_pop_spare(spares));
+        }
+    }
+
+    /**
+     * Relocates *src into slot i of x, with right as the child after it
+     * when x is internal. A full x is split first with a spare node, which
+     * pushes its median up into the parent, recursively up to a new root.
+     */
+    iterator    _place(node_pointer x, size_type i, pointer src,
+                       node_pointer right, node_pointer& spares) {
+        if (x->count == node_base::slots) {
+            node_pointer    sibling = _split(x, spares);
+
+            if (i > x->count) {
+                i -= x->count + 1;
+                x = sibling;
+            }
+        }
+        for (size_type j = x->count; j > i; --j) {
+            _move_value(x, j, x, j - 1);
+        }
+        _relocate(&x->value(i), src);
+        if (!x->leaf) {
+            for (size_type j = x->count + 1; j > i + 1; --j) {
+                _set_child(x, j, x->child(j - 1));
+            }
+            _set_child(x, i + 1, right);
+        }
+        ++x->count;
+        return iterator(x, i);
+    }
+
+    /**
+     * Moves the upper half of the full node x into a spare right sibling
+     * and its median into the parent, between the two. Returns the sibling.
+     */
+    node_pointer    _split(node_pointer x, node_pointer& spares) {
+        const size_type half = node_base::min_slots;
+        node_pointer    sibling = _pop_spare(spares);
+        node_pointer    parent = x->parent;
+
+        if (!parent) {
+            parent = _pop_spare(spares);
+            _set_child(parent, 0, x);
+        }
+        for (size_type j = 0; j < half; ++j) {
+            _move_value(sibling, j, x, half + 1 + j);
+        }
+        if (!x->leaf) {
+            for (size_type j = 0; j <= half; ++j) {
+                _set_child(sibling, j, x->child(half + 1 + j));
+            }
+        }
+        sibling->count = half;
+        x->count = half;
+        if (x == _root) {
+            _root = parent;
+        }
+        if (x == _rightmost) {
+            _rightmost = sibling;
+        }
+        _place(parent, x->position, &x->value(half), sibling, spares);
+        return sibling;
+    }
+
+    /**
+     * Other values cannot be shifted without copies that may throw, so the
+     * nodes the insertion changes are rebuilt aside: v goes in slot i of
+     * n, left replaces child i and right follows it when n is internal.
+     * A full n is rebuilt as two halves whose median goes up the same way.
+     * Only once the parents are done are the old nodes swapped out, which
+     * cannot throw. Appending to a node that has room needs no copy.
+     */
+    iterator    _insert_copying(node_pointer n, size_type i,
+                                const value_type& v,
+                                node_pointer left, node_pointer right) {
+        if (n->count < node_base::slots && i == n->count) {
+            _value_allocator.construct(&n->value(i), v);
+            if (!n->leaf) {
+                _set_child(n, i, left);
+                _set_child(n, i + 1, right);
+            }
+            ++n->count;
+            return iterator(n, i);
+        }
+        if (n->count < node_base::slots) {
+            node_pointer    y = _copy_inserting(n, i, v, 0, n->count + 1);
+
+            _adopt_children(y, n, i, left, right, 0);
+            if (n->parent) {
+                _set_child(n->parent, n->position, y);
+            } else {
+                _root = y;
+            }
+            if (n == _leftmost) {
+                _leftmost = y;
+            }
+            if (n == _rightmost) {
+                _rightmost = y;
+            }
+            _discard(n);
+            return iterator(y, i);
+        }
+        const size_type     half = node_base::min_slots;
+        node_pointer        low = _copy_inserting(n, i, v, 0, half);
+        node_pointer        high = 0;
+        iterator            up;
+
+        try {
+            high = _copy_inserting(n, i, v, half + 1, node_base::slots + 1);
+            const value_type&   median = _inserted(n, i, v, half);
+
+            if (n->parent) {
+                up = _insert_copying(n->parent, n->position, median,
+                                     low, high);
+            } else {
+                up = _new_root(median, low, high);
+            }
+        } catch (...) {
+            _discard(low);
+            if (high) {
+                _discard(high);
+            }
+            throw;
+        }
+        _adopt_children(low, n, i, left, right, 0);
+        _adopt_children(high, n, i, left, right, half + 1);
+        if (n == _leftmost) {
+            _leftmost = low;
+        }
+        if (n == _rightmost) {
+            _rightmost = high;
+        }
+        _discard(n);
+        if (i == half) {
+            return up;
+        }
+        return i < half ? iterator(low, i) : iterator(high, i - half - 1);
+    }
+
+    /* Slot k of n as it reads once v is inserted in slot i. */
+    static const value_type&    _inserted(node_pointer n, size_type i,
+                                          const value_type& v, size_type k) {
+        if (k == i) {
+            return v;
+        }
+        return n->value(k < i ? k : k - 1);
+    }
+
+    /* A new node holding copies of slots first to last of n plus v. */
+    node_pointer    _copy_inserting(node_pointer n, size_type i,
+                                    const value_type& v,
+                                    size_type first, size_type last) {
+        node_pointer    y = _create_node(n->leaf);
+
+        try {
+            for (size_type k = first; k < last; ++k, ++y->count) {
+                _value_allocator.construct(&y->value(y->count),
+                                           _inserted(n, i, v, k));
+            }
+        } catch (...) {
+            _discard(y);
+            throw;
+        }
+        return y;
+    }
+
+    /**
+     * Gives y the children of n from first on, as they read once left
+     * replaces child i and right is inserted after it.
+     */
+    static void     _adopt_children(node_pointer y, node_pointer n,
+                                    size_type i, node_pointer left,
+                                    node_pointer right, size_type first) {
+        if (y->leaf) {
+            return;
+        }
+        for (size_type j = 0; j <= y->count; ++j) {
+            size_type       k = first + j;
+            node_pointer    child = right;
+
+            if (k < i || k > i + 1) {
+                child = n->child(k < i ? k : k - 1);
+            } else if (k == i) {
+                child = left;
+            }
+            _set_child(y, j, child);
+        }
+    }
+
+    iterator    _new_root(const value_type& median,
+                          node_pointer low, node_pointer high) {
+        node_pointer    root = _create_node(false);
+
+        try {
+            _value_allocator.construct(&root->value(0), median);
+        } catch (...) {
+            _free_node(root);
+            throw;
+        }
+        root->count = 1;
+        _set_child(root, 0, low);
+        _set_child(root, 1, high);
+        _root = root;
+        return iterator(root, 0);
+    }
+
+    /*                          Removal                         */
+
+    /**
+     * A value in an internal node is replaced by its predecessor, which
+     * always sits at the end of a leaf, so only leaves ever lose a slot.
+     */
+    void    _erase_at(node_pointer x, size_type i) {
+        _value_allocator.destroy(&x->value(i));
+        if (!x->leaf) {
+            node_pointer    leaf = node_base::rightmost_leaf(x->child(i));
+
+            _move_value(x, i, leaf, leaf->count - 1);
+            x = leaf;
+            i = leaf->count - 1;
+        }
+        for (size_type j = i + 1; j < x->count; ++j) {
+            _move_value(x, j - 1, x, j);
+        }
+        --x->count;
+        --_size;
+        _rebalance(x);
+    }
+
+    /**
+     * Refills x while it has fewer than min_slots values: a sibling with
+     * values to spare lends one through the parent, otherwise x and a
+     * sibling merge and the parent, one value short, is checked next.
+     */
+    void    _rebalance(node_pointer x) {
+        while (x != _root && x->count < node_base::min_slots) {
+            node_pointer    parent = x->parent;
+            size_type       p = x->position;
+
+            if (p > 0 && parent->child(p - 1)->count > node_base::min_slots) {
+                _rotate_right(parent, p - 1);
+                return;
+            }
+            if (p < parent->count
+                && parent->child(p + 1)->count > node_base::min_slots) {
+                _rotate_left(parent, p);
+                return;
+            }
+            _merge(parent, p > 0 ? p - 1 : p);
+            x = parent;
+        }
+        if (_root->count) {
+            return;
+        }
+        node_pointer    old_root = _root;
+
+        if (_root->leaf) {
+            _root = _leftmost = _rightmost = 0;
+        } else {
+            _root = _root->child(0);
+            _root->parent = 0;
+            _root->position = 0;
+        }
+        _free_node(old_root);
+    }
+
+    /* The last value of child s moves up to slot s; slot s goes right. */
+    void    _rotate_right(node_pointer parent, size_type s) {
+        node_pointer    left = parent->child(s);
+        node_pointer    right = parent->child(s + 1);
+
+        for (size_type j = right->count; j > 0; --j) {
+            _move_value(right, j, right, j - 1);
+        }
+        _move_value(right, 0, parent, s);
+        _move_value(parent, s, left, left->count - 1);
+        if (!right->leaf) {
+            for (size_type j = right->count + 1; j > 0; --j) {
+                _set_child(right, j, right->child(j - 1));
+            }
+            _set_child(right, 0, left->child(left->count));
+        }
+        ++right->count;
+        --left->count;
+    }
+
+    /* The first value of child s + 1 moves up to slot s; slot s goes left. */
+    void    _rotate_left(node_pointer parent, size_type s) {
+        node_pointer    left = parent->child(s);
+        node_pointer    right = parent->child(s + 1);
+
+        _move_value(left, left->count, parent, s);
+        _move_value(parent, s, right, 0);
+        for (size_type j = 1; j < right->count; ++j) {
+            _move_value(right, j - 1, right, j);
+        }
+        if (!left->leaf) {
+            _set_child(left, left->count + 1, right->child(0));
+            for (size_type j = 1; j <= right->count; ++j) {
+                _set_child(right, j - 1, right->child(j));
+            }
+        }
+        ++left->count;
+        --right->count;
+    }
+
+    /* Child s absorbs slot s and child s + 1, which is freed. */
+    void    _merge(node_pointer parent, size_type s) {
+        node_pointer    left = parent->child(s);
+        node_pointer    right = parent->child(s + 1);
+        size_type       offset = left->count + 1;
+
+        _move_value(left, left->count, parent, s);
+        for (size_type j = 0; j < right->count; ++j) {
+            _move_value(left, offset + j, right, j);
+        }
+        if (!left->leaf) {
+            for (size_type j = 0; j <= right->count; ++j) {
+                _set_child(left, offset + j, right->child(j));
+            }
+        }
+        left->count += right->count + 1;
+        for (size_type j = s + 1; j < parent->count; ++j) {
+            _move_value(parent, j - 1, parent, j);
+        }
+        for (size_type j = s + 2; j <= parent->count; ++j) {
+            _set_child(parent, j - 1, parent->child(j));
+        }
+        --parent->count;
+        if (right == _rightmost) {
+            _rightmost = left;
+        }
+        _free_node(right);
+    }
+};  /* class btree */
+
+}   /* namespace ft */
+
+#endif  /* BTREE_BTREE_HPP_ */
@@ -0,0 +1,167 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef BTREE_BTREE_NODE_HPP_
+#define BTREE_BTREE_NODE_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+/* What a B-tree leaf aims to fill: four 64-byte cache lines. */
+static const std::size_t    btree_node_bytes = 256;
+
+/**
+ * A B-tree node holds up to `slots` values in sorted order, in raw storage
+ * the tree constructs and destroys them in. Internal nodes are
+ * btree_internal_node, which appends count + 1 children after the values;
+ * every node knows its parent and its position among the parent's children,
+ * so iterators can walk the tree without a stack.
+ */
+template <typename T, std::size_t Bytes = btree_node_bytes>
+struct btree_node {
+    typedef T                   value_type;
+    typedef std::size_t         size_type;
+    typedef btree_node*         node_pointer;
+    typedef const btree_node*   const_node_pointer;
+
+    /**
+     * As many values as fit in Bytes after the node's own fields, at least
+     * three. The count is odd, so a full node splits into two halves of
+     * min_slots values around its median.
+     */
+    static const size_type  fit = (Bytes - 2 * sizeof(void*)) / sizeof(T);
+    static const size_type  slots = fit < 3 ? 3 : (fit - 1) | 1;
+    static const size_type  min_slots = slots / 2;
+
+    node_pointer    parent;
+    unsigned short  position;
+    unsigned short  count;
+    bool            leaf;
+
+    explicit btree_node(bool is_leaf = true)
+        :   parent(0),
+            position(0),
+            count(0),
+            leaf(is_leaf) {}
+
+    value_type&         value(size_type i) {
+        return reinterpret_cast<value_type*>(_storage.bytes)[i];
+    }
+
+    const value_type&   value(size_type i) const {
+        return reinterpret_cast<const value_type*>(_storage.bytes)[i];
+    }
+
+    /* Only internal nodes have children. */
+    node_pointer&       child(size_type i);
+    const_node_pointer  child(size_type i) const;
+
+    static node_pointer leftmost_leaf(node_pointer x) {
+        while (!x->leaf) {
+            x = x->child(0);
+        }
+        return x;
+    }
+
+    static node_pointer rightmost_leaf(node_pointer x) {
+        while (!x->leaf) {
+            x = x->child(x->count);
+        }
+        return x;
+    }
+
+    /**
+     * Steps the slot (x, i) forward in order. Past the last value it stays
+     * at (x, x->count), which is how end() is spelled on the rightmost leaf.
+     */
+    static void increment(node_pointer& x, size_type& i) {
+        if (!x->leaf) {
+            x = leftmost_leaf(x->child(i + 1));
+            i = 0;
+            return;
+        }
+        if (++i < x->count) {
+            return;
+        }
+        node_pointer    y = x;
+        size_type       j = i;
+
+        while (y->parent && j == y->count) {
+            j = y->position;
+            y = y->parent;
+        }
+        if (j < y->count) {
+            x = y;
+            i = j;
+        }
+    }
+
+    static void decrement(node_pointer& x, size_type& i) {
+        if (!x->leaf) {
+            x = rightmost_leaf(x->child(i));
+            i = x->count - 1;
+            return;
+        }
+        if (i > 0) {
+            --i;
+            return;
+        }
+        node_pointer    y = x;
+        size_type       j = 0;
+
+        while (y->parent && j == 0) {
+            j = y->position;
+            y = y->parent;
+        }
+        if (j > 0) {
+            x = y;
+            i = j - 1;
+        }
+    }
+
+ private:
+    union {
+        char        bytes[slots * sizeof(T)];
+        long double align_long_double;
+        long        align_long;
+        void*       align_pointer;
+    } _storage;
+};  /* struct btree_node */
+
+template <typename T, std::size_t Bytes>
+const std::size_t   btree_node<T, Bytes>::fit;
+
+template <typename T, std::size_t Bytes>
+const std::size_t   btree_node<T, Bytes>::slots;
+
+template <typename T, std::size_t Bytes>
+const std::size_t   btree_node<T, Bytes>::min_slots;
+
+template <typename T, std::size_t Bytes = btree_node_bytes>
+struct btree_internal_node : public btree_node<T, Bytes> {
+    typedef btree_node<T, Bytes>    node_base;
+
+    node_base*  children[node_base::slots + 1];
+
+    btree_internal_node() : node_base(false) {
+        for (std::size_t i = 0; i <= node_base::slots; ++i) {
+            children[i] = 0;
+        }
+    }
+};  /* struct btree_internal_node */
+
+template <typename T, std::size_t Bytes>
+inline btree_node<T, Bytes>*&  btree_node<T, Bytes>::child(size_type i) {
+    return static_cast<btree_internal_node<T, Bytes>*>(this)->children[i];
+}
+
+template <typename T, std::size_t Bytes>
+inline const btree_node<T, Bytes>*
+                        btree_node<T, Bytes>::child(size_type i) const {
+    return static_cast<const btree_internal_node<T, Bytes>*>(this)
+                                                        ->children[i];
+}
+
+}   /* namespace ft */
+
+#endif  /* BTREE_BTREE_NODE_HPP_ */
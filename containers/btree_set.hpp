@@ -0,0 +1,238 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_BTREE_SET_HPP_
+#define CONTAINERS_BTREE_SET_HPP_
+
+#include <functional>
+#include <memory>
+
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+#include "../utility/pair.hpp"
+#include "../utility/functional.hpp"
+#include "../btree/btree.hpp"
+
+namespace ft {
+
+/**
+ * Same interface as ft::set over a B-tree, see ft::btree_map: denser and
+ * faster to search, but inserting or erasing invalidates all iterators.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+        typename AllocTp = std::allocator<Key> >
+class btree_set {
+ public:
+    typedef Key                                     key_type;
+    typedef Key                                     value_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef Compare                                 key_compare;
+    typedef Compare                                 value_compare;
+    typedef AllocTp                                 allocator_type;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type*                             pointer;
+    typedef const value_type*                       const_pointer;
+
+ private:
+    typedef btree<key_type, value_type, ft::identity<value_type>,
+                  key_compare, AllocTp>             btreeBase;
+
+ public:
+    typedef typename btreeBase::iterator            iterator;
+    typedef typename btreeBase::const_iterator      const_iterator;
+    typedef ft::reverse_iter<iterator>              reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+
+    btree_set() : _key_comp(key_compare()),
+                  _btree(key_compare(), AllocTp()) {}
+
+    explicit btree_set(const Compare& comp, const AllocTp& alloc = AllocTp())
+        :   _key_comp(comp),
+            _btree(comp, alloc) {}
+
+    template<class InputIt>
+    btree_set(InputIt first, InputIt last,
+              const Compare& comp = Compare(),
+              const AllocTp& alloc = AllocTp())
+        :   _key_comp(comp),
+            _btree(comp, alloc) { insert(first, last); }
+
+    btree_set(const btree_set& src)
+        :   _key_comp(src._key_comp),
+            _btree(src._btree) {}
+
+    ~btree_set() {}
+
+    btree_set&  operator=(const btree_set& src) {
+        if (&src != this) {
+            _key_comp = src._key_comp;
+            _btree = src._btree;
+        }
+        return *this;
+    }
+
+    /*                              Allocator:                            */
+
+    AllocTp                get_allocator(void) const {
+        return _btree.get_allocator();
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return _btree.begin(); }
+    iterator               end(void) { return _btree.end(); }
+    const_iterator         begin(void) const { return _btree.begin(); }
+    const_iterator         end(void) const { return _btree.end(); }
+
+    reverse_iterator       rbegin(void) { return reverse_iterator(end()); }
+    reverse_iterator       rend(void) { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin(void) const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend(void) const {
+        return const_reverse_iterator(begin());
+    }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _btree.size(); }
+    size_type              max_size(void) const { return _btree.max_size(); }
+    bool                   empty(void) const { return !_btree.size(); }
+
+    /*                              Observers:                            */
+
+    key_compare            key_comp(void) const { return _key_comp; }
+    value_compare          value_comp(void) const { return _key_comp; }
+
+    /*                              Modifiers:                            */
+
+    ft::pair<iterator, bool>   insert(const value_type& data) {
+        return _btree.insert_unique(data);
+    }
+
+    iterator   insert(iterator pos, const value_type& data) {
+        return _btree.insert_unique(pos, data);
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _btree.insert_range(first, last);
+    }
+
+    void erase(iterator pos) {
+        _btree.erase(pos);
+    }
+
+    size_type  erase(const key_type& key) {
+        return _btree.remove(key);
+    }
+
+    void erase(iterator first, iterator last) {
+        _btree.erase(first, last);
+    }
+
+    void swap(btree_set& x) {
+        _btree.swap(x._btree);
+
+        key_compare tmp(_key_comp);
+
+        _key_comp = x._key_comp;
+        x._key_comp = tmp;
+    }
+
+    void clear(void) { _btree.clear(); }
+
+    /*                              Lookup:                               */
+
+    iterator               find(const key_type& key) {
+        return _btree.find(key);
+    }
+
+    const_iterator         find(const key_type& key) const {
+        return _btree.find(key);
+    }
+
+    size_type              count(const key_type& key) const {
+        return find(key) != end();
+    }
+
+    iterator               lower_bound(const key_type& key) {
+        return _btree.lower_bound(key);
+    }
+
+    const_iterator         lower_bound(const key_type& key) const {
+        return _btree.lower_bound(key);
+    }
+
+    iterator               upper_bound(const key_type& key) {
+        return _btree.upper_bound(key);
+    }
+
+    const_iterator         upper_bound(const key_type& key) const {
+        return _btree.upper_bound(key);
+    }
+
+    ft::pair<iterator, iterator>    equal_range(const key_type& key) {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+ private:
+    key_compare _key_comp;
+    btreeBase   _btree;
+};  /* class btree_set */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator==(const btree_set<Key, Compare, AllocTp>& x,
+                 const btree_set<Key, Compare, AllocTp>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator!=(const btree_set<Key, Compare, AllocTp>& x,
+                 const btree_set<Key, Compare, AllocTp>& y) {
+    return !(x == y);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<(const btree_set<Key, Compare, AllocTp>& x,
+                const btree_set<Key, Compare, AllocTp>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<=(const btree_set<Key, Compare, AllocTp>& x,
+                 const btree_set<Key, Compare, AllocTp>& y) {
+    return !(y < x);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>(const btree_set<Key, Compare, AllocTp>& x,
+                const btree_set<Key, Compare, AllocTp>& y) {
+    return y < x;
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>=(const btree_set<Key, Compare, AllocTp>& x,
+                 const btree_set<Key, Compare, AllocTp>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+void  swap(btree_set<Key, Compare, AllocTp>& x,
+           btree_set<Key, Compare, AllocTp>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_BTREE_SET_HPP_ */
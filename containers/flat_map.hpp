@@ -0,0 +1,285 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_FLAT_MAP_HPP_
+#define CONTAINERS_FLAT_MAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+#include "../utility/pair.hpp"
+#include "../iterators/reverse_iter.hpp"
+#include "../flat/flat_tree.hpp"
+
+namespace ft {
+
+/**
+ * Same lookup interface as ft::map over a sorted ft::vector: no per-node
+ * overhead, and reads walk contiguous memory. Built for maps filled once,
+ * ideally through the range insert(), then read many times; inserting or
+ * erasing a single element is linear and invalidates iterators.
+ * ft::flat_split_storage<Key, T> as Storage keeps keys and mapped values
+ * in separate vectors, making searches denser still.
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Storage = ft::flat_pair_storage<Key, T> >
+class flat_map {
+ private:
+    typedef flat_tree<Storage, Compare>             flatTreeBase;
+
+ public:
+    typedef Key                                     key_type;
+    typedef T                                       mapped_type;
+    typedef typename Storage::value_type            value_type;
+    typedef Compare                                 key_compare;
+    typedef Storage                                 storage_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef std::size_t                             size_type;
+
+    typedef typename flatTreeBase::iterator         iterator;
+    typedef typename flatTreeBase::const_iterator   const_iterator;
+    typedef ft::reverse_iter<iterator>              reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+    typedef typename ft::iterator_traits<
+                        iterator>::reference        reference;
+    typedef typename ft::iterator_traits<
+                        const_iterator>::reference  const_reference;
+
+    class value_compare : std::binary_function<value_type, value_type, bool> {
+        friend class flat_map<Key, T, Compare, Storage>;
+     protected:
+        Compare comp;
+
+        explicit value_compare(Compare c = Compare()) : comp(c) {}
+
+     public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const {
+            return comp(lhs.first, rhs.first);
+        }
+    };
+
+    flat_map() : _key_comp(key_compare()), _flat_tree(key_compare()) {}
+
+    explicit flat_map(const Compare& comp)
+        :   _key_comp(comp),
+            _flat_tree(comp) {}
+
+    template<class InputIt>
+    flat_map(InputIt first, InputIt last, const Compare& comp = Compare())
+        :   _key_comp(comp),
+            _flat_tree(comp) { insert(first, last); }
+
+    flat_map(const flat_map& src)
+        :   _key_comp(src._key_comp),
+            _flat_tree(src._flat_tree) {}
+
+    ~flat_map() {}
+
+    flat_map&   operator=(const flat_map& src) {
+        if (&src != this) {
+            _key_comp = src._key_comp;
+            _flat_tree = src._flat_tree;
+        }
+        return *this;
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return _flat_tree.begin(); }
+    iterator               end(void) { return _flat_tree.end(); }
+    const_iterator         begin(void) const { return _flat_tree.begin(); }
+    const_iterator         end(void) const { return _flat_tree.end(); }
+
+    reverse_iterator       rbegin(void) { return reverse_iterator(end()); }
+    reverse_iterator       rend(void) { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin(void) const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend(void) const {
+        return const_reverse_iterator(begin());
+    }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _flat_tree.size(); }
+    size_type              max_size(void) const {
+        return _flat_tree.max_size();
+    }
+    bool                   empty(void) const { return !_flat_tree.size(); }
+    size_type              capacity(void) const {
+        return _flat_tree.capacity();
+    }
+    void                   reserve(size_type n) { _flat_tree.reserve(n); }
+
+    /*                          Element access:                           */
+
+    mapped_type&           operator[](const key_type& key) {
+        size_type   i = _flat_tree.insert_unique(
+                                    value_type(key, mapped_type())).first;
+
+        return _flat_tree.storage().mapped(i);
+    }
+
+    mapped_type&           at(const key_type& key) {
+        size_type   i = _flat_tree.index_of(key);
+
+        if (i == size()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return _flat_tree.storage().mapped(i);
+    }
+
+    const mapped_type&     at(const key_type& key) const {
+        size_type   i = _flat_tree.index_of(key);
+
+        if (i == size()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return (*(begin() + i)).second;
+    }
+
+    /*                              Modifiers:                            */
+
+    ft::pair<iterator, bool>   insert(const value_type& pair) {
+        ft::pair<size_type, bool>   ret = _flat_tree.insert_unique(pair);
+
+        return ft::make_pair(begin() + ret.first, ret.second);
+    }
+
+    iterator   insert(iterator pos, const value_type& pair) {
+        return begin() + _flat_tree.insert_unique(pos - begin(), pair);
+    }
+
+    /* Sorts the new elements apart and merges them in, see flat_tree. */
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _flat_tree.insert_range(first, last);
+    }
+
+    void erase(iterator pos) {
+        size_type   i = pos - begin();
+
+        _flat_tree.erase(i, i + 1);
+    }
+
+    size_type  erase(const key_type& key) {
+        return _flat_tree.remove(key);
+    }
+
+    void erase(iterator first, iterator last) {
+        _flat_tree.erase(first - begin(), last - begin());
+    }
+
+    void swap(flat_map& x) {
+        _flat_tree.swap(x._flat_tree);
+
+        key_compare tmp(_key_comp);
+
+        _key_comp = x._key_comp;
+        x._key_comp = tmp;
+    }
+
+    void clear(void) { _flat_tree.clear(); }
+
+    /*                              Observers:                            */
+
+    key_compare            key_comp(void) const { return _key_comp; }
+    value_compare          value_comp(void) const {
+        return value_compare(_key_comp);
+    }
+
+    /*                              Lookup:                               */
+
+    iterator               find(const key_type& key) {
+        return begin() + _flat_tree.index_of(key);
+    }
+
+    const_iterator         find(const key_type& key) const {
+        return begin() + _flat_tree.index_of(key);
+    }
+
+    size_type              count(const key_type& key) const {
+        return _flat_tree.index_of(key) != size();
+    }
+
+    iterator               lower_bound(const key_type& key) {
+        return begin() + _flat_tree.lower_index(key);
+    }
+
+    const_iterator         lower_bound(const key_type& key) const {
+        return begin() + _flat_tree.lower_index(key);
+    }
+
+    iterator               upper_bound(const key_type& key) {
+        return begin() + _flat_tree.upper_index(key);
+    }
+
+    const_iterator         upper_bound(const key_type& key) const {
+        return begin() + _flat_tree.upper_index(key);
+    }
+
+    ft::pair<iterator, iterator>    equal_range(const key_type& key) {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+ private:
+    key_compare     _key_comp;
+    flatTreeBase    _flat_tree;
+};  /* class flat_map */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator==(const flat_map<Key, T, Compare, Storage>& x,
+                 const flat_map<Key, T, Compare, Storage>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator!=(const flat_map<Key, T, Compare, Storage>& x,
+                 const flat_map<Key, T, Compare, Storage>& y) {
+    return !(x == y);
+}
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator<(const flat_map<Key, T, Compare, Storage>& x,
+                const flat_map<Key, T, Compare, Storage>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator<=(const flat_map<Key, T, Compare, Storage>& x,
+                 const flat_map<Key, T, Compare, Storage>& y) {
+    return !(y < x);
+}
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator>(const flat_map<Key, T, Compare, Storage>& x,
+                const flat_map<Key, T, Compare, Storage>& y) {
+    return y < x;
+}
+
+template <typename Key, typename T, typename Compare, typename Storage>
+bool  operator>=(const flat_map<Key, T, Compare, Storage>& x,
+                 const flat_map<Key, T, Compare, Storage>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename T, typename Compare, typename Storage>
+void  swap(flat_map<Key, T, Compare, Storage>& x,
+           flat_map<Key, T, Compare, Storage>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_FLAT_MAP_HPP_ */
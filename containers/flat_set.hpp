@@ -0,0 +1,241 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_FLAT_SET_HPP_
+#define CONTAINERS_FLAT_SET_HPP_
+
+#include <functional>
+#include <memory>
+
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+#include "../utility/pair.hpp"
+#include "../iterators/reverse_iter.hpp"
+#include "../flat/flat_tree.hpp"
+
+namespace ft {
+
+/**
+ * Same lookup interface as ft::set over a sorted ft::vector, see
+ * ft::flat_map: contiguous and cheap to read, linear to change one element
+ * at a time. Inserting or erasing invalidates all iterators.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+        typename AllocTp = std::allocator<Key> >
+class flat_set {
+ public:
+    typedef Key                                     key_type;
+    typedef Key                                     value_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef Compare                                 key_compare;
+    typedef Compare                                 value_compare;
+    typedef AllocTp                                 allocator_type;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type*                             pointer;
+    typedef const value_type*                       const_pointer;
+
+ private:
+    typedef flat_tree<ft::flat_key_storage<Key, AllocTp>,
+                      key_compare>                  flatTreeBase;
+
+ public:
+    typedef typename flatTreeBase::iterator         iterator;
+    typedef typename flatTreeBase::const_iterator   const_iterator;
+    typedef ft::reverse_iter<iterator>              reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+
+    flat_set() : _key_comp(key_compare()), _flat_tree(key_compare()) {}
+
+    explicit flat_set(const Compare& comp)
+        :   _key_comp(comp),
+            _flat_tree(comp) {}
+
+    template<class InputIt>
+    flat_set(InputIt first, InputIt last, const Compare& comp = Compare())
+        :   _key_comp(comp),
+            _flat_tree(comp) { insert(first, last); }
+
+    flat_set(const flat_set& src)
+        :   _key_comp(src._key_comp),
+            _flat_tree(src._flat_tree) {}
+
+    ~flat_set() {}
+
+    flat_set&   operator=(const flat_set& src) {
+        if (&src != this) {
+            _key_comp = src._key_comp;
+            _flat_tree = src._flat_tree;
+        }
+        return *this;
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return _flat_tree.begin(); }
+    iterator               end(void) { return _flat_tree.end(); }
+    const_iterator         begin(void) const { return _flat_tree.begin(); }
+    const_iterator         end(void) const { return _flat_tree.end(); }
+
+    reverse_iterator       rbegin(void) { return reverse_iterator(end()); }
+    reverse_iterator       rend(void) { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin(void) const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend(void) const {
+        return const_reverse_iterator(begin());
+    }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _flat_tree.size(); }
+    size_type              max_size(void) const {
+        return _flat_tree.max_size();
+    }
+    bool                   empty(void) const { return !_flat_tree.size(); }
+    size_type              capacity(void) const {
+        return _flat_tree.capacity();
+    }
+    void                   reserve(size_type n) { _flat_tree.reserve(n); }
+
+    /*                              Observers:                            */
+
+    key_compare            key_comp(void) const { return _key_comp; }
+    value_compare          value_comp(void) const { return _key_comp; }
+
+    /*                              Modifiers:                            */
+
+    ft::pair<iterator, bool>   insert(const value_type& data) {
+        ft::pair<size_type, bool>   ret = _flat_tree.insert_unique(data);
+
+        return ft::make_pair(begin() + ret.first, ret.second);
+    }
+
+    iterator   insert(iterator pos, const value_type& data) {
+        return begin() + _flat_tree.insert_unique(pos - begin(), data);
+    }
+
+    /* Sorts the new elements apart and merges them in, see flat_tree. */
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _flat_tree.insert_range(first, last);
+    }
+
+    void erase(iterator pos) {
+        size_type   i = pos - begin();
+
+        _flat_tree.erase(i, i + 1);
+    }
+
+    size_type  erase(const key_type& key) {
+        return _flat_tree.remove(key);
+    }
+
+    void erase(iterator first, iterator last) {
+        _flat_tree.erase(first - begin(), last - begin());
+    }
+
+    void swap(flat_set& x) {
+        _flat_tree.swap(x._flat_tree);
+
+        key_compare tmp(_key_comp);
+
+        _key_comp = x._key_comp;
+        x._key_comp = tmp;
+    }
+
+    void clear(void) { _flat_tree.clear(); }
+
+    /*                              Lookup:                               */
+
+    iterator               find(const key_type& key) {
+        return begin() + _flat_tree.index_of(key);
+    }
+
+    const_iterator         find(const key_type& key) const {
+        return begin() + _flat_tree.index_of(key);
+    }
+
+    size_type              count(const key_type& key) const {
+        return _flat_tree.index_of(key) != size();
+    }
+
+    iterator               lower_bound(const key_type& key) {
+        return begin() + _flat_tree.lower_index(key);
+    }
+
+    const_iterator         lower_bound(const key_type& key) const {
+        return begin() + _flat_tree.lower_index(key);
+    }
+
+    iterator               upper_bound(const key_type& key) {
+        return begin() + _flat_tree.upper_index(key);
+    }
+
+    const_iterator         upper_bound(const key_type& key) const {
+        return begin() + _flat_tree.upper_index(key);
+    }
+
+    ft::pair<iterator, iterator>    equal_range(const key_type& key) {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+ private:
+    key_compare _key_comp;
+    flatTreeBase    _flat_tree;
+};  /* class flat_set */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator==(const flat_set<Key, Compare, AllocTp>& x,
+                 const flat_set<Key, Compare, AllocTp>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator!=(const flat_set<Key, Compare, AllocTp>& x,
+                 const flat_set<Key, Compare, AllocTp>& y) {
+    return !(x == y);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<(const flat_set<Key, Compare, AllocTp>& x,
+                const flat_set<Key, Compare, AllocTp>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<=(const flat_set<Key, Compare, AllocTp>& x,
+                 const flat_set<Key, Compare, AllocTp>& y) {
+    return !(y < x);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>(const flat_set<Key, Compare, AllocTp>& x,
+                const flat_set<Key, Compare, AllocTp>& y) {
+    return y < x;
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>=(const flat_set<Key, Compare, AllocTp>& x,
+                 const flat_set<Key, Compare, AllocTp>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+void  swap(flat_set<Key, Compare, AllocTp>& x,
+           flat_set<Key, Compare, AllocTp>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_FLAT_SET_HPP_ */
@@ -0,0 +1,367 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_FROZEN_SET_HPP_
+#define CONTAINERS_FROZEN_SET_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+#include "../utility/pair.hpp"
+#include "../containers/vector.hpp"
+#include "../iterators/reverse_iter.hpp"
+#include "../iterators/eytzinger_iter.hpp"
+
+namespace ft {
+
+/**
+ * Read-only sorted set for lookup tables that never change once built,
+ * from an ft::set, a sorted ft::vector or any other range. The keys are
+ * laid out in Eytzinger order, the breadth-first order of a complete
+ * binary search tree, in one array: the first levels of every search
+ * share the same few cache lines, and each step down is a branchless
+ * index computation while the cache line four levels below is
+ * prefetched. Iteration still visits the keys in order.
+ */
+template <typename Key, typename Compare = std::less<Key>,
+        typename AllocTp = std::allocator<Key> >
+class frozen_set {
+ public:
+    typedef Key                                     key_type;
+    typedef Key                                     value_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef Compare                                 key_compare;
+    typedef Compare                                 value_compare;
+    typedef AllocTp                                 allocator_type;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type*                             pointer;
+    typedef const value_type*                       const_pointer;
+
+    typedef ft::eytzinger_iter<const_pointer>       iterator;
+    typedef ft::eytzinger_iter<const_pointer>       const_iterator;
+    typedef ft::reverse_iter<iterator>              reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+
+    explicit frozen_set(const Compare& comp = Compare(),
+                        const AllocTp& alloc = AllocTp())
+        :   _key_comp(comp),
+            _allocator(alloc),
+            _data(0),
+            _size(0) {}
+
+    /* Sorts a copy of the range and keeps the first of equivalent keys. */
+    template<class InputIt>
+    frozen_set(InputIt first, InputIt last,
+               const Compare& comp = Compare(),
+               const AllocTp& alloc = AllocTp())
+        :   _key_comp(comp),
+            _allocator(alloc),
+            _data(0),
+            _size(0) {
+        ft::vector<value_type, AllocTp> sorted(alloc);
+
+        for (; first != last; ++first) {
+            sorted.push_back(*first);
+        }
+        _build(&sorted);
+    }
+
+    frozen_set(const frozen_set& src)
+        :   _key_comp(src._key_comp),
+            _allocator(src._allocator),
+            _data(0),
+            _size(0) {
+        _copy(src);
+    }
+
+    ~frozen_set() { _release(); }
+
+    frozen_set& operator=(const frozen_set& src) {
+        if (&src != this) {
+            frozen_set  tmp(src);
+
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    /*                              Allocator:                            */
+
+    AllocTp                get_allocator(void) const { return _allocator; }
+
+    /*                              Iterators:                            */
+
+    const_iterator         begin(void) const {
+        return const_iterator(_data, eytzinger_layout::first(_size), _size);
+    }
+    const_iterator         end(void) const {
+        return const_iterator(_data, 0, _size);
+    }
+
+    const_reverse_iterator rbegin(void) const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend(void) const {
+        return const_reverse_iterator(begin());
+    }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _size; }
+    size_type              max_size(void) const {
+        return _allocator.max_size() - 1;
+    }
+    bool                   empty(void) const { return !_size; }
+
+    /*                              Observers:                            */
+
+    key_compare            key_comp(void) const { return _key_comp; }
+    value_compare          value_comp(void) const { return _key_comp; }
+
+    /*                              Modifiers:                            */
+
+    void swap(frozen_set& x) {
+        _swap(_key_comp, x._key_comp);
+        _swap(_allocator, x._allocator);
+        _swap(_data, x._data);
+        _swap(_size, x._size);
+    }
+
+    /*                              Lookup:                               */
+
+    const_iterator         find(const key_type& key) const {
+        size_type   k = _lower_slot(key);
+
+        if (k && !_key_comp(key, _data[k])) {
+            return const_iterator(_data, k, _size);
+        }
+        return end();
+    }
+
+    size_type              count(const key_type& key) const {
+        size_type   k = _lower_slot(key);
+
+        return k && !_key_comp(key, _data[k]);
+    }
+
+    const_iterator         lower_bound(const key_type& key) const {
+        return const_iterator(_data, _lower_slot(key), _size);
+    }
+
+    const_iterator         upper_bound(const key_type& key) const {
+        return const_iterator(_data, _upper_slot(key), _size);
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+ private:
+    key_compare     _key_comp;
+    AllocTp         _allocator;
+    pointer         _data;
+    size_type       _size;
+
+    template <typename U>
+    static void     _swap(U& x, U& y) {
+        U   tmp(x);
+
+        x = y;
+        y = tmp;
+    }
+
+    /**
+     * The descent goes right past every key less than key and left
+     * otherwise, with no branch to mispredict; where it last went left is
+     * the lower bound.
+     */
+    size_type   _lower_slot(const key_type& key) const {
+        size_type   k = 1;
+
+        while (k <= _size) {
+            _prefetch(k);
+            k = 2 * k + static_cast<size_type>(_key_comp(_data[k], key));
+        }
+        return eytzinger_layout::up_from_right(k);
+    }
+
+    size_type   _upper_slot(const key_type& key) const {
+        size_type   k = 1;
+
+        while (k <= _size) {
+            _prefetch(k);
+            k = 2 * k + static_cast<size_type>(!_key_comp(key, _data[k]));
+        }
+        return eytzinger_layout::up_from_right(k);
+    }
+
+    /**
+     * The descendants of slot k four levels down are the sixteen slots
+     * from 16k: for keys of four bytes or less, a cache line the search
+     * will read a few steps later.
+     */
+    void        _prefetch(size_type k) const {
+#if defined(__GNUC__) || defined(__clang__)
+        static const size_type  stride = sizeof(value_type) < 64
+                                        ? 64 / sizeof(value_type) : 1;
+        size_type               ahead = k * stride;
+
+        __builtin_prefetch(_data + (ahead <= _size ? ahead : _size));
+#else
+        (void)k;
+#endif
+    }
+
+    /**
+     * Fills the slots in order, walking the layout from its first slot:
+     * slot 0 is never constructed. A throwing copy destroys the slots
+     * filled so far, which are the ones before it in that same order.
+     */
+    void        _build(ft::vector<value_type, AllocTp>* sorted) {
+        value_type* values = sorted->data();
+        size_type   count = sorted->size();
+
+        if (!_is_sorted(values, count)) {
+            std::stable_sort(values, values + count, _key_comp);
+        }
+        count = _unique(values, count);
+        if (!count) {
+            return;
+        }
+        _data = _allocator.allocate(count + 1);
+        _size = count;
+
+        size_type   k = eytzinger_layout::first(_size);
+
+        try {
+            for (size_type i = 0; i < count; ++i) {
+                _allocator.construct(_data + k, values[i]);
+                k = eytzinger_layout::next(k, _size);
+            }
+        } catch (...) {
+            _release_until(k);
+            throw;
+        }
+    }
+
+    /* Same size, same layout: every slot is copied where it is. */
+    void        _copy(const frozen_set& src) {
+        if (!src._size) {
+            return;
+        }
+        _data = _allocator.allocate(src._size + 1);
+        _size = src._size;
+
+        size_type   k = 1;
+
+        try {
+            for (; k <= _size; ++k) {
+                _allocator.construct(_data + k, src._data[k]);
+            }
+        } catch (...) {
+            while (--k) {
+                _allocator.destroy(_data + k);
+            }
+            _allocator.deallocate(_data, _size + 1);
+            _data = 0;
+            _size = 0;
+            throw;
+        }
+    }
+
+    bool        _is_sorted(const value_type* values, size_type count) const {
+        for (size_type i = 1; i < count; ++i) {
+            if (_key_comp(values[i], values[i - 1])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Packs the first of each run of equivalent keys at the front. */
+    size_type   _unique(value_type* values, size_type count) const {
+        size_type   kept = count ? 1 : 0;
+
+        for (size_type i = 1; i < count; ++i) {
+            if (_key_comp(values[kept - 1], values[i])) {
+                if (kept != i) {
+                    values[kept] = values[i];
+                }
+                ++kept;
+            }
+        }
+        return kept;
+    }
+
+    /* Destroys the slots before slot end in sorted order, and frees all. */
+    void        _release_until(size_type end) {
+        for (size_type k = eytzinger_layout::first(_size); k != end;
+                k = eytzinger_layout::next(k, _size)) {
+            _allocator.destroy(_data + k);
+        }
+        _allocator.deallocate(_data, _size + 1);
+        _data = 0;
+        _size = 0;
+    }
+
+    void        _release(void) {
+        if (_data) {
+            _release_until(0);
+        }
+    }
+};  /* class frozen_set */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator==(const frozen_set<Key, Compare, AllocTp>& x,
+                 const frozen_set<Key, Compare, AllocTp>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator!=(const frozen_set<Key, Compare, AllocTp>& x,
+                 const frozen_set<Key, Compare, AllocTp>& y) {
+    return !(x == y);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<(const frozen_set<Key, Compare, AllocTp>& x,
+                const frozen_set<Key, Compare, AllocTp>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator<=(const frozen_set<Key, Compare, AllocTp>& x,
+                 const frozen_set<Key, Compare, AllocTp>& y) {
+    return !(y < x);
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>(const frozen_set<Key, Compare, AllocTp>& x,
+                const frozen_set<Key, Compare, AllocTp>& y) {
+    return y < x;
+}
+
+template <typename Key, typename Compare, typename AllocTp>
+bool  operator>=(const frozen_set<Key, Compare, AllocTp>& x,
+                 const frozen_set<Key, Compare, AllocTp>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename Compare, typename AllocTp>
+void  swap(frozen_set<Key, Compare, AllocTp>& x,
+           frozen_set<Key, Compare, AllocTp>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_FROZEN_SET_HPP_ */
@@ -9,12 +9,18 @@
 #include "../algorithm/equal.hpp"
 #include "../algorithm/lexicographical_compare.hpp"
 #include "../utility/pair.hpp"
+#include "../utility/functional.hpp"
+#include "../type_traits/type_traits.hpp"
 #include "../rb_tree/rb_tree.hpp"
+#include "../rb_tree/pool_allocator.hpp"
+#include "../rb_tree/node_update.hpp"
+#include "../rb_tree/node_handle.hpp"
 
 namespace ft {
 
 template <typename Key, typename T, typename Compare = std::less<Key>,
-   typename AllocTp = std::allocator<ft::pair<const Key, T> > >
+   typename AllocTp = ft::pool_allocator<ft::pair<const Key, T> >,
+   typename NodeUpdate = ft::null_node_update>
 class map {
  public:
     typedef Key                                     key_type;
@@ -29,13 +35,28 @@ class map {
     typedef std::ptrdiff_t                          difference_type;
     typedef std::size_t                             size_type;
 
-    typedef ft::rb_tree_iter<pointer>               iterator;
-    typedef ft::rb_tree_iter<const_pointer>         const_iterator;
+ private:
+    typedef rb_tree<key_type, value_type, ft::select_first<value_type>,
+                    key_compare, AllocTp, NodeUpdate>   rbTreeBase;
+
+    /* Mapped values folded by NodeUpdate are only written by update(). */
+    static const bool   _const_values = ft::reads_values<NodeUpdate>::value;
+    typedef typename ft::conditional<_const_values, const mapped_type&,
+                                     mapped_type&>::type    mapped_reference;
+
+ public:
+    typedef typename ft::conditional<_const_values,
+                typename rbTreeBase::const_iterator,
+                typename rbTreeBase::iterator>::type    iterator;
+    typedef typename rbTreeBase::const_iterator     const_iterator;
     typedef ft::reverse_iter<iterator>              reverse_iterator;
     typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+    typedef ft::node_handle<typename rbTreeBase::node_base,
+                            typename rbTreeBase::node_allocator,
+                            key_type, mapped_type>  node_type;
 
     class value_compare : std::binary_function<value_type, value_type, bool> {
-        friend class map<Key, T, Compare, AllocTp>;
+        friend class map<Key, T, Compare, AllocTp, NodeUpdate>;
      protected:
         Compare comp;
 
@@ -48,36 +69,38 @@ class map {
     };
 
     map() : _key_comp(key_compare()),
-            _rb_tree(value_compare(key_compare()), AllocTp()) {}
+            _rb_tree(key_compare(), AllocTp()) {}
 
     explicit map(const Compare& comp, AllocTp alloc = AllocTp())
         :   _key_comp(comp),
-            _rb_tree(value_compare(comp), alloc) {}
+            _rb_tree(comp, alloc) {}
 
     template<class InputIt>
     map(InputIt first, InputIt last,
         const Compare& comp = Compare(),
         const AllocTp& alloc = AllocTp())
         :   _key_comp(comp),
-            _rb_tree(value_compare(comp), alloc) { insert(first, last); }
+            _rb_tree(comp, alloc) { insert(first, last); }
 
     map(const map& src)
-        :   _key_comp(key_compare()),
-            _rb_tree(value_compare(key_compare()), AllocTp()) { *this = src; }
+        :   _key_comp(src._key_comp),
+            _rb_tree(src._rb_tree) {}
 
     ~map() {}
 
     map&    operator=(const map& src) {
         if (&src != this) {
-            _rb_tree.clear();
-            insert(src.begin(), src.end());
+            _key_comp = src._key_comp;
+            _rb_tree = src._rb_tree;
         }
         return *this;
     }
 
     /*                              Allocator:                            */
 
-    AllocTp                get_allocator(void) const { return AllocTp(); }
+    AllocTp                get_allocator(void) const {
+        return AllocTp(_rb_tree.get_allocator());
+    }
 
     /*                              Iterators:                            */
 
@@ -103,13 +126,14 @@ class map {
 
     /*                          Element access:                           */
 
-    mapped_type&           operator[](const key_type& key) {
-        iterator insert_ret = insert(ft::make_pair(key, mapped_type())).first;
+    mapped_reference       operator[](const key_type& key) {
+        iterator insert_ret = _rb_tree.insert_unique(
+                                    value_type(key, mapped_type())).first;
 
         return insert_ret->second;
     }
 
-    mapped_type&           at(const key_type& key) {
+    mapped_reference       at(const key_type& key) {
         iterator insert_ret = insert(ft::make_pair(key, mapped_type())).first;
 
         return insert_ret->second;
@@ -118,48 +142,100 @@ class map {
     /*                              Modifiers:                            */
 
     ft::pair<iterator, bool>   insert(const value_type& pair) {
-        node_pointer    node = _rb_tree.search(pair);
-        if (node) {
-            return ft::make_pair(iterator(node), false);
-        }
-        return ft::make_pair(_rb_tree.insert(pair), true);
+        return _rb_tree.insert_unique(pair);
     }
 
     iterator   insert(iterator pos, const value_type& pair) {
-        if (_rb_tree.upper_bound(pair) != pos.base()) {
-            return _rb_tree.insert(pair);
-        } else {
-            return _rb_tree.insert(pair, pos.base());
-        }
+        return _rb_tree.insert_unique(pos.base(), pair);
     }
 
     template <class InputIterator>
     void insert(InputIterator first, InputIterator last) {
-        while (first != last) {
-            _rb_tree.insert(*first);
-            ++first;
+        _rb_tree.insert_range(first, last);
+    }
+
+    /**
+     * extract() unlinks an element without destroying it; inserting the
+     * handle links the node back, here or into another map of the same
+     * type whose allocator compares equal, with no copy of the value;
+     * otherwise the value is copied. A failed insert leaves the handle
+     * owning its node.
+     */
+    ft::pair<iterator, bool>   insert(node_type& node) {
+        return _rb_tree.reinsert_unique(node);
+    }
+
+    iterator   insert(iterator pos, node_type& node) {
+        return _rb_tree.reinsert_unique(pos.base(), node);
+    }
+
+    node_type  extract(iterator pos) {
+        return node_type(_rb_tree.extract(pos.base()),
+                         _rb_tree.get_allocator());
+    }
+
+    node_type  extract(const key_type& key) {
+        node_pointer    node = _rb_tree.search(key);
+
+        if (!node) {
+            return node_type();
         }
+        return extract(iterator(node));
     }
 
     void erase(iterator pos) {
-        _rb_tree.remove(*pos);
+        _rb_tree.erase(pos.base());
     }
 
     size_type  erase(const key_type& key) {
-        return _rb_tree.remove(ft::make_pair(key, mapped_type()));
+        return _rb_tree.remove(key);
     }
 
     void erase(iterator first, iterator last) {
-        iterator it;
-        while (first != last) {
-            it = first++;
-            _rb_tree.remove(*it);
-        }
+        _rb_tree.erase(first.base(), last.base());
     }
 
     void swap(map& x) { _rb_tree.swap(x._rb_tree); }
     void clear(void) { _rb_tree.clear(); }
 
+    /**
+     * Moves the elements with keys not ordered before key into dest. When
+     * both allocators compare equal, as copies of get_allocator() or
+     * allocators built with ft::shared_pool do, nodes are relinked and no
+     * element is copied; otherwise they are copied into dest. Cutting the
+     * tree is O(log n), but its size has to be split too: that is O(log n)
+     * as well with order_statistics_update, otherwise O(min(k, n - k))
+     * steps to count the k elements moved. A non-empty dest then merges
+     * them in.
+     */
+    void split_off(const key_type& key, map& dest) {
+        if (dest.empty() && dest.get_allocator() == get_allocator()) {
+            _rb_tree.split(key, dest._rb_tree);
+        } else {
+            map    tail(_key_comp, get_allocator());
+
+            _rb_tree.split(key, tail._rb_tree);
+            dest.merge(tail);
+        }
+    }
+
+    /**
+     * Moves in the elements of src whose keys are not here yet, relinking
+     * nodes when both allocators compare equal. If all of src is ordered
+     * before or after this map, both trees are joined in O(log n).
+     */
+    void merge(map& src) { _rb_tree.merge_unique(src._rb_tree); }
+
+    /**
+     * Set algebra in place, against the keys of other: unite() adds its
+     * elements whose keys are not here yet, intersect() keeps only the keys
+     * it has, subtract() drops them. O(m log(n / m + 1)) for sizes m <= n,
+     * plus the elements added or destroyed; other is not modified.
+     */
+    void unite(const map& other) { _rb_tree.unite_unique(other._rb_tree); }
+    void intersect(const map& other) { _rb_tree.intersect(other._rb_tree); }
+    void subtract(const map& other) { _rb_tree.subtract(other._rb_tree); }
+
 
     /*                              Observers:                            */
 
@@ -171,41 +247,40 @@ class map {
     /*                              Lookup:                               */
 
     iterator               find(const key_type& key) {
-        node_pointer node = _rb_tree.search(ft::make_pair(key, mapped_type()));
+        node_pointer node = _rb_tree.search(key);
         if (!node)
             return _rb_tree.end();
         return iterator(node);
     }
     const_iterator         find(const key_type& key) const {
-        const_node_pointer node = _rb_tree.search(
-                                            ft::make_pair(key, mapped_type()));
+        const_node_pointer node = _rb_tree.search(key);
         if (!node)
             return _rb_tree.end();
         return const_iterator(node);
     }
 
     size_type              count(const key_type& key) const {
-        return _rb_tree.search(ft::make_pair(key, mapped_type())) != 0;
+        return _rb_tree.search(key) != 0;
     }
 
     iterator               lower_bound(const key_type& key) {
         return iterator(
-            _rb_tree.lower_bound(ft::make_pair(key, mapped_type())));
+            _rb_tree.lower_bound(key));
     }
 
     const_iterator         lower_bound(const key_type& key) const {
         return const_iterator(
-            _rb_tree.lower_bound(ft::make_pair(key, mapped_type())));
+            _rb_tree.lower_bound(key));
     }
 
     iterator               upper_bound(const key_type& key) {
         return iterator(
-            _rb_tree.upper_bound(ft::make_pair(key, mapped_type())));
+            _rb_tree.upper_bound(key));
     }
 
     const_iterator         upper_bound(const key_type& key) const {
         return const_iterator(
-            _rb_tree.upper_bound(ft::make_pair(key, mapped_type())));
+            _rb_tree.upper_bound(key));
     }
 
     ft::pair<iterator, iterator>    equal_range(const key_type& key) {
@@ -221,10 +296,126 @@ class map {
             upper_bound(key));
     }
 
+    /*                          Order statistics:                         */
+
+    /**
+     * Only available with ft::order_statistics_update as NodeUpdate. nth()
+     * is the k-th smallest element (end() when k >= size()), rank() the
+     * number of keys less than key, and distance() the number of elements
+     * in [first, last). All are O(log n).
+     */
+
+    iterator               nth(size_type k) {
+        return iterator(_rb_tree.select(k));
+    }
+
+    const_iterator         nth(size_type k) const {
+        return const_iterator(_rb_tree.select(k));
+    }
+
+    size_type              rank(const key_type& key) const {
+        return _rb_tree.rank(key);
+    }
+
+    difference_type        distance(const_iterator first,
+                                    const_iterator last) const {
+        return static_cast<difference_type>(_rb_tree.position(last.base()))
+             - static_cast<difference_type>(_rb_tree.position(first.base()));
+    }
+
+    /*                          Range aggregates:                         */
+
+    /**
+     * Only available with ft::aggregate_update as NodeUpdate: the monoid
+     * fold of the elements whose keys are in [lo, hi), in O(log n).
+     */
+    typename NodeUpdate::metadata_type
+                           aggregate(const key_type& lo,
+                                     const key_type& hi) const {
+        return _rb_tree.aggregate(lo, hi);
+    }
+
+    /**
+     * Writes the mapped value of pos and refolds the path above it, in
+     * O(log n). Iterators only give const access to mapped values when
+     * NodeUpdate folds them, so this is how to change one then.
+     */
+    void                   update(iterator pos, const mapped_type& value) {
+        pos.base()->data.second = value;
+        _rb_tree.refresh(pos.base());
+    }
+
+    /**
+     * Heterogeneous lookups, only available when Compare defines
+     * is_transparent: key may be anything the comparator can order against
+     * a key_type, and no key_type is built from it.
+     */
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           find(const K& key) {
+        node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           find(const K& key) const {
+        const_node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return const_iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+                           count(const K& key) const {
+        return _rb_tree.search(key) != 0;
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           lower_bound(const K& key) {
+        return iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           lower_bound(const K& key) const {
+        return const_iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           upper_bound(const K& key) {
+        return iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           upper_bound(const K& key) const {
+        return const_iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<iterator, iterator> >::type
+                           equal_range(const K& key) {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<const_iterator, const_iterator> >::type
+                           equal_range(const K& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
  private:
-    typedef rb_tree<value_type, value_compare, AllocTp>     rbTreeBase;
-    typedef node<value_type>*                               node_pointer;
-    typedef const node<value_type>*                         const_node_pointer;
+    typedef typename rbTreeBase::node_pointer               node_pointer;
+    typedef typename rbTreeBase::const_node_pointer         const_node_pointer;
 
     key_compare _key_comp;
     rbTreeBase  _rb_tree;
@@ -232,46 +423,54 @@ class map {
 
 /*                          Relational Operators                      */
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator==(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator==(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator!=(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator!=(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return !(x == y);
 }
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator<(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator<=(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<=(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return !(y < x);
 }
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator>(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return y < x;
 }
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-bool  operator>=(const map<Key, T, Compare, AllocTp>& x,
-                 const map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>=(const map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     return !(x < y);
 }
 
 /*                          Non member functions                      */
 
-template <typename Key, typename T, typename Compare, typename AllocTp>
-void  swap(map<Key, T, Compare, AllocTp>& x, map<Key, T, Compare, AllocTp>& y) {
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+void  swap(map<Key, T, Compare, AllocTp, NodeUpdate>& x,
+           map<Key, T, Compare, AllocTp, NodeUpdate>& y) {
     x.swap(y);
 }
 
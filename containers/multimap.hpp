@@ -0,0 +1,403 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_MULTIMAP_HPP_
+#define CONTAINERS_MULTIMAP_HPP_
+
+#include <functional>
+#include <memory>
+
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+#include "../utility/pair.hpp"
+#include "../utility/functional.hpp"
+#include "../type_traits/type_traits.hpp"
+#include "../rb_tree/rb_tree.hpp"
+#include "../rb_tree/pool_allocator.hpp"
+#include "../rb_tree/node_update.hpp"
+
+namespace ft {
+
+/**
+ * Same interface as ft::map, but every inserted element is kept: equivalent
+ * keys sit next to each other, in insertion order.
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>,
+   typename AllocTp = ft::pool_allocator<ft::pair<const Key, T> >,
+   typename NodeUpdate = ft::null_node_update>
+class multimap {
+ public:
+    typedef Key                                     key_type;
+    typedef T                                       mapped_type;
+    typedef ft::pair<const key_type, mapped_type>   value_type;
+    typedef Compare                                 key_compare;
+    typedef AllocTp                                 allocator_type;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type*                             pointer;
+    typedef const value_type*                       const_pointer;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef std::size_t                             size_type;
+
+ private:
+    typedef rb_tree<key_type, value_type, ft::select_first<value_type>,
+                    key_compare, AllocTp, NodeUpdate>   rbTreeBase;
+
+    /* Mapped values folded by NodeUpdate are only written by update(). */
+    static const bool   _const_values = ft::reads_values<NodeUpdate>::value;
+
+ public:
+    typedef typename ft::conditional<_const_values,
+                typename rbTreeBase::const_iterator,
+                typename rbTreeBase::iterator>::type    iterator;
+    typedef typename rbTreeBase::const_iterator     const_iterator;
+    typedef ft::reverse_iter<iterator>              reverse_iterator;
+    typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+
+    class value_compare : std::binary_function<value_type, value_type, bool> {
+        friend class multimap<Key, T, Compare, AllocTp, NodeUpdate>;
+     protected:
+        Compare comp;
+
+        explicit value_compare(Compare c = Compare()) : comp(c) {}
+
+     public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const {
+            return comp(lhs.first, rhs.first);
+        }
+    };
+
+    multimap()
+        :   _key_comp(key_compare()),
+            _rb_tree(key_compare(), AllocTp()) {}
+
+    explicit multimap(const Compare& comp, AllocTp alloc = AllocTp())
+        :   _key_comp(comp),
+            _rb_tree(comp, alloc) {}
+
+    template<class InputIt>
+    multimap(InputIt first, InputIt last,
+        const Compare& comp = Compare(),
+        const AllocTp& alloc = AllocTp())
+        :   _key_comp(comp),
+            _rb_tree(comp, alloc) { insert(first, last); }
+
+    multimap(const multimap& src)
+        :   _key_comp(src._key_comp),
+            _rb_tree(src._rb_tree) {}
+
+    ~multimap() {}
+
+    multimap&   operator=(const multimap& src) {
+        if (&src != this) {
+            _key_comp = src._key_comp;
+            _rb_tree = src._rb_tree;
+        }
+        return *this;
+    }
+
+    /*                              Allocator:                            */
+
+    AllocTp                get_allocator(void) const {
+        return AllocTp(_rb_tree.get_allocator());
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return _rb_tree.begin(); }
+    iterator               end(void) { return _rb_tree.end(); }
+    const_iterator         begin(void) const { return _rb_tree.begin(); }
+    const_iterator         end(void) const { return _rb_tree.end(); }
+
+    reverse_iterator       rbegin(void) { return reverse_iterator(end()); }
+    reverse_iterator       rend(void) { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin(void) const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend(void) const {
+        return const_reverse_iterator(begin());
+    }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _rb_tree.size(); }
+    size_type              max_size(void) const { return _rb_tree.max_size(); }
+    bool                   empty(void) const { return !_rb_tree.size(); }
+
+    /*                              Modifiers:                            */
+
+    iterator   insert(const value_type& pair) {
+        return _rb_tree.insert_equal(pair);
+    }
+
+    iterator   insert(iterator pos, const value_type& pair) {
+        return _rb_tree.insert_equal(pos.base(), pair);
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _rb_tree.insert_equal_range(first, last);
+    }
+
+    void erase(iterator pos) {
+        _rb_tree.erase(pos.base());
+    }
+
+    size_type  erase(const key_type& key) {
+        return _rb_tree.remove_equal(key);
+    }
+
+    void erase(iterator first, iterator last) {
+        _rb_tree.erase(first.base(), last.base());
+    }
+
+    void swap(multimap& x) { _rb_tree.swap(x._rb_tree); }
+    void clear(void) { _rb_tree.clear(); }
+
+
+    /*                              Observers:                            */
+
+    key_compare            key_comp(void) const { return Compare(); }
+    value_compare          value_comp(void) const {
+        return value_compare(_key_comp);
+    }
+
+    /*                              Lookup:                               */
+
+    iterator               find(const key_type& key) {
+        node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return iterator(node);
+    }
+    const_iterator         find(const key_type& key) const {
+        const_node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return const_iterator(node);
+    }
+
+    size_type              count(const key_type& key) const {
+        return _rb_tree.count(key);
+    }
+
+    iterator               lower_bound(const key_type& key) {
+        return iterator(
+            _rb_tree.lower_bound(key));
+    }
+
+    const_iterator         lower_bound(const key_type& key) const {
+        return const_iterator(
+            _rb_tree.lower_bound(key));
+    }
+
+    iterator               upper_bound(const key_type& key) {
+        return iterator(
+            _rb_tree.upper_bound(key));
+    }
+
+    const_iterator         upper_bound(const key_type& key) const {
+        return const_iterator(
+            _rb_tree.upper_bound(key));
+    }
+
+    ft::pair<iterator, iterator>    equal_range(const key_type& key) {
+        node_range  range = _rb_tree.equal_range(key);
+
+        return ft::make_pair(iterator(range.first), iterator(range.second));
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        node_range  range = _rb_tree.equal_range(key);
+
+        return ft::make_pair(const_iterator(range.first),
+                             const_iterator(range.second));
+    }
+
+    /*                          Order statistics:                         */
+
+    /**
+     * Only available with ft::order_statistics_update as NodeUpdate. nth()
+     * is the k-th smallest element (end() when k >= size()), rank() the
+     * number of keys less than key, and distance() the number of elements
+     * in [first, last). All are O(log n).
+     */
+
+    iterator               nth(size_type k) {
+        return iterator(_rb_tree.select(k));
+    }
+
+    const_iterator         nth(size_type k) const {
+        return const_iterator(_rb_tree.select(k));
+    }
+
+    size_type              rank(const key_type& key) const {
+        return _rb_tree.rank(key);
+    }
+
+    difference_type        distance(const_iterator first,
+                                    const_iterator last) const {
+        return static_cast<difference_type>(_rb_tree.position(last.base()))
+             - static_cast<difference_type>(_rb_tree.position(first.base()));
+    }
+
+    /*                          Range aggregates:                         */
+
+    /**
+     * Only available with ft::aggregate_update as NodeUpdate: the monoid
+     * fold of the elements whose keys are in [lo, hi), in O(log n).
+     */
+    typename NodeUpdate::metadata_type
+                           aggregate(const key_type& lo,
+                                     const key_type& hi) const {
+        return _rb_tree.aggregate(lo, hi);
+    }
+
+    /**
+     * Writes the mapped value of pos and refolds the path above it, in
+     * O(log n). Iterators only give const access to mapped values when
+     * NodeUpdate folds them, so this is how to change one then.
+     */
+    void                   update(iterator pos, const mapped_type& value) {
+        pos.base()->data.second = value;
+        _rb_tree.refresh(pos.base());
+    }
+
+    /**
+     * Heterogeneous lookups, only available when Compare defines
+     * is_transparent: key may be anything the comparator can order against
+     * a key_type, and no key_type is built from it.
+     */
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           find(const K& key) {
+        node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           find(const K& key) const {
+        const_node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return const_iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+                           count(const K& key) const {
+        return _rb_tree.count(key);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           lower_bound(const K& key) {
+        return iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           lower_bound(const K& key) const {
+        return const_iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           upper_bound(const K& key) {
+        return iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           upper_bound(const K& key) const {
+        return const_iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<iterator, iterator> >::type
+                           equal_range(const K& key) {
+        node_range  range = _rb_tree.equal_range(key);
+
+        return ft::make_pair(iterator(range.first), iterator(range.second));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<const_iterator, const_iterator> >::type
+                           equal_range(const K& key) const {
+        node_range  range = _rb_tree.equal_range(key);
+
+        return ft::make_pair(const_iterator(range.first),
+                             const_iterator(range.second));
+    }
+
+ private:
+    typedef typename rbTreeBase::node_pointer               node_pointer;
+    typedef typename rbTreeBase::const_node_pointer         const_node_pointer;
+    typedef ft::pair<node_pointer, node_pointer>            node_range;
+
+    key_compare _key_comp;
+    rbTreeBase  _rb_tree;
+}; /* class multimap */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator==(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator!=(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return !(x == y);
+}
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<=(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return !(y < x);
+}
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return y < x;
+}
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>=(const multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+                 const multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename T, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+void  swap(multimap<Key, T, Compare, AllocTp, NodeUpdate>& x,
+           multimap<Key, T, Compare, AllocTp, NodeUpdate>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_MULTIMAP_HPP_ */
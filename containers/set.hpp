@@ -9,12 +9,18 @@
 #include "../algorithm/equal.hpp"
 #include "../algorithm/lexicographical_compare.hpp"
 #include "../utility/pair.hpp"
+#include "../utility/functional.hpp"
+#include "../type_traits/type_traits.hpp"
 #include "../rb_tree/rb_tree.hpp"
+#include "../rb_tree/pool_allocator.hpp"
+#include "../rb_tree/node_update.hpp"
+#include "../rb_tree/node_handle.hpp"
 
 namespace ft {
 
 template <typename Key, typename Compare = std::less<Key>,
-        typename AllocTp = std::allocator<Key> >
+        typename AllocTp = ft::pool_allocator<Key>,
+        typename NodeUpdate = ft::null_node_update>
 class set {
  public:
     typedef Key                                     key_type;
@@ -29,10 +35,17 @@ class set {
     typedef value_type*                             pointer;
     typedef const value_type*                       const_pointer;
 
-    typedef ft::rb_tree_iter<pointer>               iterator;
-    typedef ft::rb_tree_iter<const_pointer>         const_iterator;
+ private:
+    typedef rb_tree<key_type, value_type, ft::identity<value_type>,
+                    key_compare, AllocTp, NodeUpdate>   rbTreeBase;
+
+ public:
+    typedef typename rbTreeBase::iterator           iterator;
+    typedef typename rbTreeBase::const_iterator     const_iterator;
     typedef ft::reverse_iter<iterator>              reverse_iterator;
     typedef ft::reverse_iter<const_iterator>        const_reverse_iterator;
+    typedef ft::node_handle<typename rbTreeBase::node_base,
+                            typename rbTreeBase::node_allocator>  node_type;
 
     set() : _key_comp(key_compare()),
             _rb_tree(key_compare(), AllocTp()) {}
@@ -49,22 +62,24 @@ class set {
             _rb_tree(comp, alloc) { insert(first, last); }
 
     set(const set& src)
-        :   _key_comp(key_compare()),
-            _rb_tree(value_compare(key_compare()), AllocTp()) { *this = src; }
+        :   _key_comp(src._key_comp),
+            _rb_tree(src._rb_tree) {}
 
     ~set() {}
 
     set&    operator=(const set& src) {
         if (&src != this) {
-            _rb_tree.clear();
-            insert(src.begin(), src.end());
+            _key_comp = src._key_comp;
+            _rb_tree = src._rb_tree;
         }
         return *this;
     }
 
     /*                              Allocator:                            */
 
-    AllocTp                get_allocator(void) const { return AllocTp(); }
+    AllocTp                get_allocator(void) const {
+        return AllocTp(_rb_tree.get_allocator());
+    }
 
     /*                              Iterators:                            */
 
@@ -97,31 +112,49 @@ class set {
     /*                              Modifiers:                            */
 
     ft::pair<iterator, bool>   insert(const value_type& data) {
-        node_pointer    node = _rb_tree.search(data);
-        if (node) {
-            return ft::make_pair(iterator(node), false);
-        }
-        return ft::make_pair(_rb_tree.insert(data), true);
+        return _rb_tree.insert_unique(data);
     }
 
     iterator   insert(iterator pos, const value_type& data) {
-        if (_rb_tree.upper_bound(data) != pos.base()) {
-            return _rb_tree.insert(data);
-        } else {
-            return _rb_tree.insert(data, pos.base());
-        }
+        return _rb_tree.insert_unique(pos.base(), data);
     }
 
     template <class InputIterator>
     void insert(InputIterator first, InputIterator last) {
-        while (first != last) {
-            _rb_tree.insert(*first);
-            ++first;
+        _rb_tree.insert_range(first, last);
+    }
+
+    /**
+     * extract() unlinks an element without destroying it; inserting the
+     * handle links the node back, here or into another set of the same
+     * type whose allocator compares equal, with no copy of the value;
+     * otherwise the value is copied. A failed insert leaves the handle
+     * owning its node.
+     */
+    ft::pair<iterator, bool>   insert(node_type& node) {
+        return _rb_tree.reinsert_unique(node);
+    }
+
+    iterator   insert(iterator pos, node_type& node) {
+        return _rb_tree.reinsert_unique(pos.base(), node);
+    }
+
+    node_type  extract(iterator pos) {
+        return node_type(_rb_tree.extract(pos.base()),
+                         _rb_tree.get_allocator());
+    }
+
+    node_type  extract(const key_type& key) {
+        node_pointer    node = _rb_tree.search(key);
+
+        if (!node) {
+            return node_type();
         }
+        return extract(iterator(node));
     }
 
     void erase(iterator pos) {
-        _rb_tree.remove(*pos);
+        _rb_tree.erase(pos.base());
     }
 
     size_type  erase(const key_type& key) {
@@ -129,16 +162,50 @@ class set {
     }
 
     void erase(iterator first, iterator last) {
-        iterator it;
-        while (first != last) {
-            it = first++;
-            _rb_tree.remove(*it);
-        }
+        _rb_tree.erase(first.base(), last.base());
     }
 
     void swap(set& x) { _rb_tree.swap(x._rb_tree); }
     void clear(void) { _rb_tree.clear(); }
 
+    /**
+     * Moves the elements with keys not ordered before key into dest. When
+     * both allocators compare equal, as copies of get_allocator() or
+     * allocators built with ft::shared_pool do, nodes are relinked and no
+     * element is copied; otherwise they are copied into dest. Cutting the
+     * tree is O(log n), but its size has to be split too: that is O(log n)
+     * as well with order_statistics_update, otherwise O(min(k, n - k))
+     * steps to count the k elements moved. A non-empty dest then merges
+     * them in.
+     */
+    void split_off(const key_type& key, set& dest) {
+        if (dest.empty() && dest.get_allocator() == get_allocator()) {
+            _rb_tree.split(key, dest._rb_tree);
+        } else {
+            set    tail(_key_comp, get_allocator());
+
+            _rb_tree.split(key, tail._rb_tree);
+            dest.merge(tail);
+        }
+    }
+
+    /**
+     * Moves in the elements of src whose keys are not here yet, relinking
+     * nodes when both allocators compare equal. If all of src is ordered
+     * before or after this set, both trees are joined in O(log n).
+     */
+    void merge(set& src) { _rb_tree.merge_unique(src._rb_tree); }
+
+    /**
+     * Set algebra in place, against the keys of other: unite() adds its
+     * elements whose keys are not here yet, intersect() keeps only the keys
+     * it has, subtract() drops them. O(m log(n / m + 1)) for sizes m <= n,
+     * plus the elements added or destroyed; other is not modified.
+     */
+    void unite(const set& other) { _rb_tree.unite_unique(other._rb_tree); }
+    void intersect(const set& other) { _rb_tree.intersect(other._rb_tree); }
+    void subtract(const set& other) { _rb_tree.subtract(other._rb_tree); }
+
     /*                              Lookup:                               */
 
     iterator               find(const key_type& key) {
@@ -191,10 +258,116 @@ class set {
             upper_bound(key));
     }
 
+    /*                          Order statistics:                         */
+
+    /**
+     * Only available with ft::order_statistics_update as NodeUpdate. nth()
+     * is the k-th smallest element (end() when k >= size()), rank() the
+     * number of keys less than key, and distance() the number of elements
+     * in [first, last). All are O(log n).
+     */
+
+    iterator               nth(size_type k) {
+        return iterator(_rb_tree.select(k));
+    }
+
+    const_iterator         nth(size_type k) const {
+        return const_iterator(_rb_tree.select(k));
+    }
+
+    size_type              rank(const key_type& key) const {
+        return _rb_tree.rank(key);
+    }
+
+    difference_type        distance(const_iterator first,
+                                    const_iterator last) const {
+        return static_cast<difference_type>(_rb_tree.position(last.base()))
+             - static_cast<difference_type>(_rb_tree.position(first.base()));
+    }
+
+    /*                          Range aggregates:                         */
+
+    /**
+     * Only available with ft::aggregate_update as NodeUpdate: the monoid
+     * fold of the elements whose keys are in [lo, hi), in O(log n).
+     */
+    typename NodeUpdate::metadata_type
+                           aggregate(const key_type& lo,
+                                     const key_type& hi) const {
+        return _rb_tree.aggregate(lo, hi);
+    }
+
+    /**
+     * Heterogeneous lookups, only available when Compare defines
+     * is_transparent: key may be anything the comparator can order against
+     * a key_type, and no key_type is built from it.
+     */
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           find(const K& key) {
+        node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           find(const K& key) const {
+        const_node_pointer node = _rb_tree.search(key);
+        if (!node)
+            return _rb_tree.end();
+        return const_iterator(node);
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+                           count(const K& key) const {
+        return _rb_tree.search(key) != 0;
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           lower_bound(const K& key) {
+        return iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           lower_bound(const K& key) const {
+        return const_iterator(_rb_tree.lower_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+                           upper_bound(const K& key) {
+        return iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+                           upper_bound(const K& key) const {
+        return const_iterator(_rb_tree.upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<iterator, iterator> >::type
+                           equal_range(const K& key) {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                            ft::pair<const_iterator, const_iterator> >::type
+                           equal_range(const K& key) const {
+        return ft::make_pair(lower_bound(key), upper_bound(key));
+    }
+
  private:
-    typedef rb_tree<value_type, value_compare, AllocTp>     rbTreeBase;
-    typedef node<value_type>*                               node_pointer;
-    typedef const node<value_type>*                         const_node_pointer;
+    typedef typename rbTreeBase::node_pointer               node_pointer;
+    typedef typename rbTreeBase::const_node_pointer         const_node_pointer;
 
     key_compare _key_comp;
     rbTreeBase  _rb_tree;
@@ -202,46 +375,54 @@ class set {
 
 /*                          Relational Operators                      */
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator==(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator==(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator!=(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator!=(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return !(x == y);
 }
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator<(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator<=(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator<=(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return !(y < x);
 }
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator>(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return y < x;
 }
 
-template <typename Key, typename Compare, typename AllocTp>
-bool  operator>=(const set<Key, Compare, AllocTp>& x,
-                 const set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+bool  operator>=(const set<Key, Compare, AllocTp, NodeUpdate>& x,
+                 const set<Key, Compare, AllocTp, NodeUpdate>& y) {
     return !(x < y);
 }
 
 /*                          Non member functions                      */
 
-template <typename Key, typename Compare, typename AllocTp>
-void  swap(set<Key, Compare, AllocTp>& x, set<Key, Compare, AllocTp>& y) {
+template <typename Key, typename Compare, typename AllocTp,
+          typename NodeUpdate>
+void  swap(set<Key, Compare, AllocTp, NodeUpdate>& x,
+           set<Key, Compare, AllocTp, NodeUpdate>& y) {
     x.swap(y);
 }
 
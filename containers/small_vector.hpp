@@ -0,0 +1,521 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_SMALL_VECTOR_HPP_
+#define CONTAINERS_SMALL_VECTOR_HPP_
+
+#include <cstring>
+#include <stdexcept>
+#include <memory>
+#include <algorithm>
+#include "../iterators/random_access_iter.hpp"
+#include "../iterators/reverse_iter.hpp"
+#include "../type_traits/type_traits.hpp"
+#include "../utility/growth_policy.hpp"
+#include "../utility/debug.hpp"
+#include "../algorithm/equal.hpp"
+#include "../algorithm/lexicographical_compare.hpp"
+
+namespace ft {
+
+/**
+ * ft::vector for sequences that are usually short: the first N elements
+ * live in a buffer inside the object, so filling a new small_vector up to
+ * N allocates nothing. Past N the elements move to the heap for good, and
+ * GrowthPolicy picks the capacity of each reallocation, as in ft::vector.
+ * Moving between the two relocates with memmove when T is trivially
+ * relocatable, as ft::vector does.
+ */
+template <class T, std::size_t N, class AllocTp = std::allocator<T>,
+          class GrowthPolicy = growth_double>
+class small_vector {
+ public:
+    typedef T                                            value_type;
+    typedef AllocTp                                      allocator_type;
+    typedef GrowthPolicy                                 growth_policy;
+    typedef std::size_t                                  size_type;
+    typedef std::ptrdiff_t                               difference_type;
+    typedef T&                                           reference;
+    typedef const T&                                     const_reference;
+    typedef T*                                           pointer;
+    typedef const T*                                     const_pointer;
+
+    typedef random_access_iter<pointer>                  iterator;
+    typedef random_access_iter<const_pointer>            const_iterator;
+    typedef reverse_iter<pointer>                        reverse_iterator;
+    typedef reverse_iter<const_pointer>                  const_reverse_iterator;
+
+    static const size_type  inline_capacity = N;
+
+    explicit small_vector(const AllocTp& alloc = AllocTp())
+        : _allocator(alloc) { _reset(); }
+
+    explicit small_vector(size_type n, const value_type& val = value_type(),
+                          const AllocTp& alloc = AllocTp())
+        : _allocator(alloc) {
+        _reset();
+        try {
+            assign(n, val);
+        } catch (...) {
+            _release();
+            throw;
+        }
+    }
+
+    template <class InputIter>
+    small_vector(InputIter first, InputIter last,
+                 const AllocTp& alloc = AllocTp())
+        : _allocator(alloc) {
+        _reset();
+        try {
+            assign(first, last);
+        } catch (...) {
+            _release();
+            throw;
+        }
+    }
+
+    small_vector(const small_vector& src) : _allocator(src._allocator) {
+        _reset();
+        try {
+            *this = src;
+        } catch (...) {
+            _release();
+            throw;
+        }
+    }
+
+    ~small_vector(void) { _release(); }
+
+    small_vector& operator=(const small_vector& src) {
+        if (this != &src) {
+            clear();
+            reserve(src.size());
+            _last = std::uninitialized_copy(src._first, src._last, _first);
+        }
+        return *this;
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return iterator(_first); }
+    iterator               end(void) { return iterator(_last); }
+    const_iterator         begin(void) const { return const_iterator(_first); }
+    const_iterator         end(void) const { return const_iterator(_last); }
+
+    reverse_iterator       rbegin(void) { return reverse_iterator(_last); }
+    reverse_iterator       rend(void) { return reverse_iterator(_first); }
+    const_reverse_iterator rbegin(void) const {
+         return const_reverse_iterator(_last);
+    }
+    const_reverse_iterator rend(void) const {
+         return const_reverse_iterator(_first);
+    }
+
+    /*                              Capacity:                             */
+
+    inline size_type size(void) const { return _last - _first; }
+    inline size_type max_size(void) const { return _allocator.max_size(); }
+    inline size_type capacity(void) const { return _end_of_storage - _first; }
+    inline bool      empty(void) const { return _first == _last; }
+
+    /* Whether the elements are still in the inline buffer. */
+    inline bool      is_inline(void) const { return _first == _inline(); }
+
+    void resize(size_type n, value_type val = value_type()) {
+        if (n < size()) {
+            _destroy(_first + n, _last);
+            _last = _first + n;
+        } else if (n > size()) {
+            if (n > capacity()) {
+                reserve(_grown_capacity(n));
+            }
+            std::uninitialized_fill(_last, _first + n, val);
+            _last = _first + n;
+        }
+    }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity <= capacity()) { return; }
+        pointer     new_first = _allocate(new_capacity);
+        pointer     new_last;
+
+        try {
+            new_last = _relocate(_first, _last, new_first);
+        } catch (...) {
+            _allocator.deallocate(new_first, new_capacity);
+            throw;
+        }
+        if (!is_inline()) {
+            _allocator.deallocate(_first, capacity());
+        }
+        _first = new_first;
+        _last = new_last;
+        _end_of_storage = new_first + new_capacity;
+    }
+
+    /*                          Element access:                           */
+
+    /* Unchecked unless FT_DEBUG is set: at() is the checked access. */
+    inline reference operator[](size_type n) {
+        FT_DEBUG_CHECK(n < size(), "small_vector::operator[]: out of range");
+        return _first[n];
+    }
+
+    inline const_reference operator[](size_type n) const {
+        FT_DEBUG_CHECK(n < size(), "small_vector::operator[]: out of range");
+        return _first[n];
+    }
+
+    inline reference at(size_type n) {
+        if (n >= size()) {
+            throw std::out_of_range("small_vector::at");
+        }
+        return _first[n];
+    }
+
+    inline const_reference at(size_type n) const {
+        if (n >= size()) {
+            throw std::out_of_range("small_vector::at");
+        }
+        return _first[n];
+    }
+
+    inline reference front(void) {
+        FT_DEBUG_CHECK(!empty(), "small_vector::front: empty vector");
+        return *_first;
+    }
+
+    inline const_reference front(void) const {
+        FT_DEBUG_CHECK(!empty(), "small_vector::front: empty vector");
+        return *_first;
+    }
+
+    inline reference back(void) {
+        FT_DEBUG_CHECK(!empty(), "small_vector::back: empty vector");
+        return *(_last - 1);
+    }
+
+    inline const_reference back(void) const {
+        FT_DEBUG_CHECK(!empty(), "small_vector::back: empty vector");
+        return *(_last - 1);
+    }
+
+    inline value_type*        data(void) { return _first; }
+    inline const value_type*  data(void) const { return _first; }
+
+    /*                              Modifiers:                            */
+
+    void assign(size_type n, const value_type& val) {
+        value_type  copy(val);
+
+        clear();
+        reserve(n);
+        std::uninitialized_fill_n(_first, n, copy);
+        _last = _first + n;
+    }
+
+    template <class InputIter>
+    void assign(InputIter first, InputIter last) {
+        _assign_dispatch(first, last, ft::is_integral<InputIter>());
+    }
+
+    /* value may be an element of the vector, moved by the reserve. */
+    void push_back(const value_type& value) {
+        if (_last == _end_of_storage) {
+            value_type  copy(value);
+
+            reserve(_grown_capacity(size() + 1));
+            _allocator.construct(_last, copy);
+        } else {
+            _allocator.construct(_last, value);
+        }
+        ++_last;
+    }
+
+    inline void   pop_back(void) {
+        if (!empty()) {
+            _allocator.destroy(--_last);
+        }
+    }
+
+    iterator   insert(iterator pos, const value_type& val) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "small_vector::insert: iterator outside the vector");
+        size_type   index = pos.base() - _first;
+
+        if (pos.base() == _last) {
+            push_back(val);
+        } else {
+            _insert_fill(index, 1, val);
+        }
+        return iterator(_first + index);
+    }
+
+    void insert(iterator pos, size_type n, const value_type& val) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "small_vector::insert: iterator outside the vector");
+        _insert_fill(pos.base() - _first, n, val);
+    }
+
+    template <class InputIter>
+    void insert(iterator pos, InputIter first, InputIter last) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "small_vector::insert: iterator outside the vector");
+        _insert_dispatch(pos, first, last, ft::is_integral<InputIter>());
+    }
+
+    iterator   erase(iterator pos) {
+        FT_DEBUG_CHECK(pos != end(),
+                       "small_vector::erase: iterator outside the vector");
+        return erase(pos, pos + 1);
+    }
+
+    iterator   erase(iterator first, iterator last) {
+        FT_DEBUG_CHECK(_within(first, begin(), last)
+                       && _within(last, first, end()),
+                       "small_vector::erase: invalid range");
+        pointer     first_ptr = first.base();
+        pointer     last_ptr = last.base();
+
+        if (first_ptr == last_ptr) { return first; }
+        if (is_trivially_relocatable<T>::value) {
+            _destroy(first_ptr, last_ptr);
+            _move_bytes(first_ptr, last_ptr, _last);
+        } else {
+            _destroy(std::copy(last_ptr, _last, first_ptr), _last);
+        }
+        _last -= last_ptr - first_ptr;
+        return first;
+    }
+
+    /**
+     * Heap buffers are exchanged; inline elements have to be copied, so
+     * then the swap can throw and takes linear time.
+     */
+    void swap(small_vector& rhs) {
+        if (is_inline() || rhs.is_inline()) {
+            small_vector    tmp(*this);
+
+            *this = rhs;
+            rhs = tmp;
+            return;
+        }
+        std::swap(_first, rhs._first);
+        std::swap(_last, rhs._last);
+        std::swap(_end_of_storage, rhs._end_of_storage);
+    }
+
+    void clear(void) {
+        _destroy(_first, _last);
+        _last = _first;
+    }
+
+    /*                              Allocator:                            */
+    AllocTp   get_allocator(void) const { return AllocTp(_allocator); }
+
+ private:
+    /* Raw storage for N elements, aligned for any fundamental type. */
+    union _inline_buffer {
+        char            bytes[sizeof(T) * (N ? N : 1)];
+        long double     align_long_double;
+        long long       align_long_long;
+        void*           align_pointer;
+        void            (*align_function)(void);
+    };
+
+    pointer             _first;
+    pointer             _last;
+    pointer             _end_of_storage;
+    allocator_type      _allocator;
+    _inline_buffer      _buffer;
+
+    /*                      Private member functions                      */
+
+    pointer         _inline(void) {
+        return reinterpret_cast<pointer>(_buffer.bytes);
+    }
+    const_pointer   _inline(void) const {
+        return reinterpret_cast<const_pointer>(_buffer.bytes);
+    }
+
+    void _reset(void) {
+        _first = _last = _inline();
+        _end_of_storage = _first + N;
+    }
+
+    void _release(void) {
+        _destroy(_first, _last);
+        if (!is_inline()) {
+            _allocator.deallocate(_first, capacity());
+        }
+        _reset();
+    }
+
+    template <class Integer>
+    void _assign_dispatch(Integer n, Integer val, true_type) {
+        assign(static_cast<size_type>(n), static_cast<value_type>(val));
+    }
+
+    template <class InputIter>
+    void _assign_dispatch(InputIter first, InputIter last, false_type) {
+        clear();
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    template <class Integer>
+    void _insert_dispatch(iterator pos, Integer n, Integer val, true_type) {
+        insert(pos, static_cast<size_type>(n), static_cast<value_type>(val));
+    }
+
+    /**
+     * Relocatable elements make room with a memmove and take the new ones
+     * from a copy of the range, whose length is then known. The others are
+     * appended, then rotated into place.
+     */
+    template <class InputIter>
+    void _insert_dispatch(iterator pos, InputIter first, InputIter last,
+                          false_type) {
+        size_type   index = pos.base() - _first;
+
+        if (is_trivially_relocatable<T>::value && pos.base() != _last) {
+            small_vector    range(first, last);
+            size_type       n = range.size();
+
+            if (n > capacity() - size()) {
+                reserve(_grown_capacity(size() + n));
+            }
+            _move_bytes(_first + index + n, _first + index, _last);
+            _move_bytes(_first + index, range._first, range._last);
+            range._last = range._first;
+            _last += n;
+            return;
+        }
+        size_type   old_size = size();
+
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+        std::rotate(_first + index, _first + old_size, _last);
+    }
+
+    void _insert_fill(size_type index, size_type n, const value_type& val) {
+        value_type  copy(val);
+
+        if (n > capacity() - size()) {
+            reserve(_grown_capacity(size() + n));
+        }
+        pointer     pos = _first + index;
+        pointer     old_last = _last;
+
+        if (is_trivially_relocatable<T>::value) {
+            _move_bytes(pos + n, pos, _last);
+            try {
+                std::uninitialized_fill_n(pos, n, copy);
+            } catch (...) {
+                _move_bytes(pos, pos + n, _last + n);
+                throw;
+            }
+            _last += n;
+        } else {
+            std::uninitialized_fill_n(_last, n, copy);
+            _last += n;
+            std::rotate(pos, old_last, _last);
+        }
+    }
+
+    size_type _grown_capacity(size_type required) const {
+        return GrowthPolicy::next_capacity(capacity(), required, max_size(),
+                                           sizeof(value_type));
+    }
+
+    pointer _allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::length_error(
+                    "cannot create small_vector larger than max_size()");
+        }
+        return _allocator.allocate(n);
+    }
+
+    /* Same as ft::vector: memmove when T allows it, else copy and destroy. */
+    pointer _relocate(pointer first, pointer last, pointer dest) {
+        if (is_trivially_relocatable<T>::value) {
+            _move_bytes(dest, first, last);
+            return dest + (last - first);
+        }
+        pointer dest_last = std::uninitialized_copy(first, last, dest);
+        _destroy(first, last);
+        return dest_last;
+    }
+
+    static void _move_bytes(pointer dest, pointer first, pointer last) {
+        if (first != last) {
+            std::memmove(static_cast<void*>(dest),
+                         static_cast<const void*>(first),
+                         (last - first) * sizeof(value_type));
+        }
+    }
+
+    void _destroy(pointer first, pointer last) {
+        if (is_trivially_destructible<T>::value) { return; }
+        for (; first != last; ++first) {
+            _allocator.destroy(first);
+        }
+    }
+
+    /* Whether it lies in [lo, hi], for the debug checks of iterators. */
+    static bool _within(iterator it, iterator lo, iterator hi) {
+        return lo.base() <= it.base() && it.base() <= hi.base();
+    }
+}; /* class small_vector */
+
+/*                          Relational Operators                      */
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator==(const small_vector<T, N, Alloc, Growth>& x,
+                 const small_vector<T, N, Alloc, Growth>& y) {
+    return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator!=(const small_vector<T, N, Alloc, Growth>& x,
+                 const small_vector<T, N, Alloc, Growth>& y) {
+    return !(x == y);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator<(const small_vector<T, N, Alloc, Growth>& x,
+                const small_vector<T, N, Alloc, Growth>& y) {
+    return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator<=(const small_vector<T, N, Alloc, Growth>& x,
+                 const small_vector<T, N, Alloc, Growth>& y) {
+    return !(y < x);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator>(const small_vector<T, N, Alloc, Growth>& x,
+                const small_vector<T, N, Alloc, Growth>& y) {
+    return y < x;
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool  operator>=(const small_vector<T, N, Alloc, Growth>& x,
+                 const small_vector<T, N, Alloc, Growth>& y) {
+    return !(x < y);
+}
+
+/*                          Non member functions                      */
+
+template <class T, std::size_t N, class Alloc, class Growth>
+void  swap(small_vector<T, N, Alloc, Growth>& x,
+           small_vector<T, N, Alloc, Growth>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif /* CONTAINERS_SMALL_VECTOR_HPP_ */
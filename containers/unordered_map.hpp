@@ -0,0 +1,267 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef CONTAINERS_UNORDERED_MAP_HPP_
+#define CONTAINERS_UNORDERED_MAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "../utility/pair.hpp"
+#include "../utility/functional.hpp"
+#include "../utility/hash.hpp"
+#include "../hash/hash_table.hpp"
+
+namespace ft {
+
+/**
+ * Unordered counterpart of ft::map, for exact-key lookups: a find hashes
+ * the key once and usually compares it with a single element, instead of
+ * walking log(n) tree nodes. Elements live in an open-addressing table
+ * (see hash_table.hpp); iterators are forward only, in no particular
+ * order, and are invalidated when an insertion makes the table grow.
+ */
+template <typename Key, typename T, typename Hash = ft::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename AllocTp = std::allocator<ft::pair<const Key, T> > >
+class unordered_map {
+ public:
+    typedef Key                                     key_type;
+    typedef T                                       mapped_type;
+    typedef ft::pair<const key_type, mapped_type>   value_type;
+    typedef Hash                                    hasher;
+    typedef KeyEqual                                key_equal;
+    typedef AllocTp                                 allocator_type;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type*                             pointer;
+    typedef const value_type*                       const_pointer;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef std::size_t                             size_type;
+
+ private:
+    typedef hash_table<key_type, value_type, ft::select_first<value_type>,
+                       hasher, key_equal, AllocTp>  hashTableBase;
+
+ public:
+    typedef typename hashTableBase::iterator        iterator;
+    typedef typename hashTableBase::const_iterator  const_iterator;
+
+    unordered_map()
+        :   _hash_table(0, hasher(), key_equal(), AllocTp()) {}
+
+    explicit unordered_map(size_type bucket_count,
+                           const hasher& hash = hasher(),
+                           const key_equal& equal = key_equal(),
+                           const AllocTp& alloc = AllocTp())
+        :   _hash_table(bucket_count, hash, equal, alloc) {}
+
+    template<class InputIt>
+    unordered_map(InputIt first, InputIt last,
+                  size_type bucket_count = 0,
+                  const hasher& hash = hasher(),
+                  const key_equal& equal = key_equal(),
+                  const AllocTp& alloc = AllocTp())
+        :   _hash_table(bucket_count, hash, equal, alloc) {
+        insert(first, last);
+    }
+
+    unordered_map(const unordered_map& src) : _hash_table(src._hash_table) {}
+
+    ~unordered_map() {}
+
+    unordered_map&  operator=(const unordered_map& src) {
+        if (&src != this) {
+            _hash_table = src._hash_table;
+        }
+        return *this;
+    }
+
+    /*                              Allocator:                            */
+
+    AllocTp                get_allocator(void) const {
+        return _hash_table.get_allocator();
+    }
+
+    /*                              Iterators:                            */
+
+    iterator               begin(void) { return _hash_table.begin(); }
+    iterator               end(void) { return _hash_table.end(); }
+    const_iterator         begin(void) const { return _hash_table.begin(); }
+    const_iterator         end(void) const { return _hash_table.end(); }
+
+    /*                              Capacity:                             */
+
+    size_type              size(void) const { return _hash_table.size(); }
+    size_type              max_size(void) const {
+        return _hash_table.max_size();
+    }
+    bool                   empty(void) const { return !_hash_table.size(); }
+
+    /*                          Element access:                           */
+
+    /* One hash and one probe, whether key is there or not. */
+    mapped_type&           operator[](const key_type& key) {
+        return _hash_table.find_or_insert(key, &_default_value).first->second;
+    }
+
+    mapped_type&           at(const key_type& key) {
+        iterator    found = _hash_table.find(key);
+
+        if (found == end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return found->second;
+    }
+
+    const mapped_type&     at(const key_type& key) const {
+        const_iterator  found = _hash_table.find(key);
+
+        if (found == end()) {
+            throw std::out_of_range("unordered_map::at");
+        }
+        return found->second;
+    }
+
+    /*                              Modifiers:                            */
+
+    ft::pair<iterator, bool>   insert(const value_type& pair) {
+        return _hash_table.insert_unique(pair);
+    }
+
+    /* The position of an element only depends on its hash: hint is unused. */
+    iterator   insert(iterator hint, const value_type& pair) {
+        (void)hint;
+        return _hash_table.insert_unique(pair).first;
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _hash_table.insert_range(first, last);
+    }
+
+    void erase(iterator pos) {
+        _hash_table.erase(pos);
+    }
+
+    size_type  erase(const key_type& key) {
+        return _hash_table.remove(key);
+    }
+
+    void erase(iterator first, iterator last) {
+        _hash_table.erase(first, last);
+    }
+
+    void swap(unordered_map& x) { _hash_table.swap(x._hash_table); }
+
+    void clear(void) { _hash_table.clear(); }
+
+    /*                              Lookup:                               */
+
+    iterator               find(const key_type& key) {
+        return _hash_table.find(key);
+    }
+
+    const_iterator         find(const key_type& key) const {
+        return _hash_table.find(key);
+    }
+
+    size_type              count(const key_type& key) const {
+        return _hash_table.find(key) != end();
+    }
+
+    ft::pair<iterator, iterator>    equal_range(const key_type& key) {
+        iterator    found = find(key);
+
+        return ft::make_pair(found, found == end() ? found : ++iterator(found));
+    }
+
+    ft::pair<const_iterator, const_iterator>
+                equal_range(const key_type& key) const {
+        const_iterator  found = find(key);
+
+        return ft::make_pair(found,
+                             found == end() ? found : ++const_iterator(found));
+    }
+
+    /*                          Bucket interface:                         */
+
+    /* Every slot of the table is a bucket holding at most one element. */
+    size_type              bucket_count(void) const {
+        return _hash_table.capacity();
+    }
+
+    float                  load_factor(void) const {
+        return bucket_count() ? static_cast<float>(size()) / bucket_count()
+                              : 0.0f;
+    }
+
+    /* Fixed: the table grows when it would be more than 7/8 full. */
+    float                  max_load_factor(void) const { return 0.875f; }
+
+    void                   rehash(size_type count) {
+        _hash_table.rehash(count);
+    }
+
+    void                   reserve(size_type count) {
+        _hash_table.reserve(count);
+    }
+
+    /*                              Observers:                            */
+
+    hasher                 hash_function(void) const {
+        return _hash_table.hash_function();
+    }
+
+    key_equal              key_eq(void) const { return _hash_table.key_eq(); }
+
+ private:
+    hashTableBase   _hash_table;
+
+    static value_type   _default_value(const key_type& key) {
+        return value_type(key, mapped_type());
+    }
+};  /* class unordered_map */
+
+/*                          Relational Operators                      */
+
+/* Same elements, whatever their order. */
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename AllocTp>
+bool  operator==(const unordered_map<Key, T, Hash, KeyEqual, AllocTp>& x,
+                 const unordered_map<Key, T, Hash, KeyEqual, AllocTp>& y) {
+    typedef typename unordered_map<Key, T, Hash, KeyEqual,
+                                   AllocTp>::const_iterator   const_iterator;
+
+    if (x.size() != y.size()) {
+        return false;
+    }
+    for (const_iterator it = x.begin(); it != x.end(); ++it) {
+        const_iterator  found = y.find(it->first);
+
+        if (found == y.end() || !(found->second == it->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename AllocTp>
+bool  operator!=(const unordered_map<Key, T, Hash, KeyEqual, AllocTp>& x,
+                 const unordered_map<Key, T, Hash, KeyEqual, AllocTp>& y) {
+    return !(x == y);
+}
+
+/*                          Non member functions                      */
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename AllocTp>
+void  swap(unordered_map<Key, T, Hash, KeyEqual, AllocTp>& x,
+           unordered_map<Key, T, Hash, KeyEqual, AllocTp>& y) {
+    x.swap(y);
+}
+
+}  /* namespace ft */
+
+#endif   /* CONTAINERS_UNORDERED_MAP_HPP_ */
@@ -3,22 +3,34 @@
 #ifndef CONTAINERS_VECTOR_HPP_
 #define CONTAINERS_VECTOR_HPP_
 
+#include <cstdlib>
+#include <cstring>
+#include <new>
 #include <stdexcept>
 #include <memory>
 #include <algorithm>
 #include "../iterators/random_access_iter.hpp"
 #include "../iterators/reverse_iter.hpp"
 #include "../type_traits/type_traits.hpp"
+#include "../utility/growth_policy.hpp"
+#include "../utility/debug.hpp"
 #include "../algorithm/equal.hpp"
 #include "../algorithm/lexicographical_compare.hpp"
 
 namespace ft {
 
-template <class T, class AllocTp = std::allocator<T> >
+/**
+ * GrowthPolicy picks the capacity of every reallocation that an insertion
+ * or a resize makes (see growth_policy.hpp); reserve and assign allocate
+ * exactly what they are asked for.
+ */
+template <class T, class AllocTp = std::allocator<T>,
+          class GrowthPolicy = growth_double>
 class vector {
  public:
     typedef T                                            value_type;
     typedef AllocTp                                      allocator_type;
+    typedef GrowthPolicy                                 growth_policy;
     typedef std::size_t                                  size_type;
     typedef std::ptrdiff_t                               difference_type;
     typedef T&                                           reference;
@@ -56,7 +68,7 @@ class vector {
 
     ~vector(void) {
         _destroy(_first, _last);
-        _allocator.deallocate(_first, capacity());
+        _deallocate(_first, capacity());
         _first = _last = _end_of_storage = 0;
     }
 
@@ -113,7 +125,7 @@ class vector {
             _last = _first + n;
         } else {
             if (n > capacity()) {
-                reserve(std::max(n, size() << 1));
+                reserve(_grown_capacity(n));
             }
             pointer old_last(_last);
             _last += n - size();
@@ -123,11 +135,20 @@ class vector {
 
     void reserve(size_type new_capacity) {
         if (new_capacity <= capacity()) { return; }
+        if (_reallocable() && _first) {
+            _reallocate(new_capacity);
+            return;
+        }
         pointer new_first = _allocate(new_capacity);
         pointer new_last = new_first;
         if (_first) {
-            new_last = std::uninitialized_copy(_first, _last, new_first);
-            _full_destroy_and_deallocate();
+            try {
+                new_last = _relocate(_first, _last, new_first);
+            } catch (...) {
+                _deallocate(new_first, new_capacity);
+                throw;
+            }
+            _deallocate(_first, capacity());
         }
         _first = new_first;
         _last = new_last;
@@ -135,38 +156,51 @@ class vector {
     }
 
     /*                          Element access:                           */
+    /* Unchecked unless FT_DEBUG is set: at() is the checked access. */
     inline reference operator[](size_type n) {
-        if (n >= capacity()) {
-            throw std::out_of_range("out_of_range");
-        }
-        return *(_first + n);
+        FT_DEBUG_CHECK(n < size(), "vector::operator[]: out of range");
+        return _first[n];
     }
 
     inline const_reference operator[](size_type n) const {
-        if (n >= capacity()) {
-            throw std::out_of_range("out_of_range");
-        }
-        return *(_first + n);
+        FT_DEBUG_CHECK(n < size(), "vector::operator[]: out of range");
+        return _first[n];
     }
 
     inline reference at(size_type n) {
-        if (n >= capacity()) {
-            throw std::out_of_range("out_of_range");
+        if (n >= size()) {
+            throw std::out_of_range("vector::at");
         }
-        return *(_first + n);
+        return _first[n];
     }
 
     inline const_reference at(size_type n) const {
-        if (n >= capacity()) {
-            throw std::out_of_range("out_of_range");
+        if (n >= size()) {
+            throw std::out_of_range("vector::at");
         }
-        return *(_first + n);
+        return _first[n];
+    }
+
+    inline reference front(void) {
+        FT_DEBUG_CHECK(!empty(), "vector::front: empty vector");
+        return *_first;
+    }
+
+    inline const_reference front(void) const {
+        FT_DEBUG_CHECK(!empty(), "vector::front: empty vector");
+        return *_first;
+    }
+
+    inline reference back(void) {
+        FT_DEBUG_CHECK(!empty(), "vector::back: empty vector");
+        return *(_last - 1);
+    }
+
+    inline const_reference back(void) const {
+        FT_DEBUG_CHECK(!empty(), "vector::back: empty vector");
+        return *(_last - 1);
     }
 
-    inline reference          front(void) { return *_first; }
-    inline const_reference    front(void) const { return *_first; }
-    inline reference          back(void) { return *(_last - 1); }
-    inline const_reference    back(void) const { return *(_last - 1); }
     inline value_type*        data(void) { return _first; }
     inline const value_type*  data(void) const { return _first; }
 
@@ -190,11 +224,16 @@ class vector {
         _assign_dispatch(first, last, is_integral<InputIter>());
     }
 
+    /* value may be an element of the vector, freed by the reserve. */
     void push_back(const value_type& value) {
         if (_last == _end_of_storage) {
-            reserve(std::max(size() << 1, static_cast<size_type>(1)));
+            value_type  copy(value);
+
+            reserve(_grown_capacity(size() + 1));
+            _allocator.construct(_last, copy);
+        } else {
+            _allocator.construct(_last, value);
         }
-        _allocator.construct(_last, value);
         ++_last;
     }
 
@@ -205,53 +244,93 @@ class vector {
     }
 
     iterator   insert(iterator pos, const value_type& val) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "vector::insert: iterator outside the vector");
         if (_last == _end_of_storage) {
             size_type   dist = pos.base() - _first;
-            reserve(std::max(size() << 1, static_cast<size_type>(1)));
-            pos = iterator(_first + dist);
+            value_type  copy(val);
+
+            reserve(_grown_capacity(size() + 1));
+            return insert(iterator(_first + dist), copy);
         }
         pointer pos_ptr = pos.base();
-        if (pos_ptr != _last) {
+        if (pos_ptr == _last) {
+            _allocator.construct(pos_ptr, val);
+        } else if (is_trivially_relocatable<T>::value) {
+            const value_type*   src = _shifted(&val, pos_ptr, 1);
+
+            _move_bytes(pos_ptr + 1, pos_ptr, _last);
+            try {
+                _allocator.construct(pos_ptr, *src);
+            } catch (...) {
+                _move_bytes(pos_ptr, pos_ptr + 1, _last + 1);
+                throw;
+            }
+        } else {
+            const value_type*   src = _shifted(&val, pos_ptr, 1);
+
             _allocator.construct(_last, *(_last - 1));
             std::copy_backward(pos_ptr, _last - 1, _last);
-            *pos_ptr = val;
-        } else {
-            _allocator.construct(pos_ptr, val);
+            *pos_ptr = *src;
         }
         ++_last;
         return pos;
     }
 
     void insert(iterator pos, size_type n, const value_type& val) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "vector::insert: iterator outside the vector");
         if (n > capacity() - size()) {
             size_type   dist = pos.base() - _first;
-            reserve(size() + std::max(n, size()));
-            pos = iterator(_first + dist);
+            value_type  copy(val);
+
+            reserve(_grown_capacity(size() + n));
+            return insert(iterator(_first + dist), n, copy);
         }
-        pointer     pos_ptr = pos.base();
-        pointer     old_last(_last);
-        size_type   pos_n(_last - pos_ptr);
+        pointer             pos_ptr = pos.base();
+        pointer             old_last(_last);
+        size_type           pos_n(_last - pos_ptr);
+        const value_type*   src = _shifted(&val, pos_ptr, n);
 
-        if (pos_n > n) {
+        if (is_trivially_relocatable<T>::value) {
+            _move_bytes(pos_ptr + n, pos_ptr, _last);
+            try {
+                std::uninitialized_fill_n(pos_ptr, n, *src);
+            } catch (...) {
+                _move_bytes(pos_ptr, pos_ptr + n, _last + n);
+                throw;
+            }
+            _last += n;
+        } else if (pos_n > n) {
             std::uninitialized_copy(_last - n, _last, _last);
             _last += n;
             std::copy_backward(pos_ptr, old_last - n, old_last);
-            std::fill_n(pos_ptr, n, val);
+            std::fill_n(pos_ptr, n, *src);
         } else {
             std::uninitialized_fill_n(_last, n - pos_n, val);
             _last += n - pos_n;
             std::uninitialized_copy(pos_ptr, old_last, _last);
             _last += pos_n;
-            std::fill(pos_ptr, old_last, val);
+            std::fill(pos_ptr, old_last, *src);
         }
     }
 
     template <class InputIter>
     void insert(iterator pos, InputIter first, InputIter last) {
+        FT_DEBUG_CHECK(_within(pos, begin(), end()),
+                       "vector::insert: iterator outside the vector");
         _insert_dispatch(pos, first, last, ft::is_integral<InputIter>());
     }
 
     iterator   erase(iterator pos) {
+        FT_DEBUG_CHECK(pos != end() && _within(pos, begin(), end()),
+                       "vector::erase: iterator outside the vector");
+        if (is_trivially_relocatable<T>::value) {
+            _allocator.destroy(pos.base());
+            _move_bytes(pos.base(), pos.base() + 1, _last);
+            --_last;
+            return pos;
+        }
         if (pos + 1 != end()) {
             std::copy(pos.base() + 1, _last, pos.base());
         }
@@ -260,12 +339,21 @@ class vector {
     }
 
     iterator   erase(iterator first, iterator last) {
+        FT_DEBUG_CHECK(_within(first, begin(), last)
+                       && _within(last, first, end()),
+                       "vector::erase: invalid range");
         if (first == end()) { return first; }
         if (last == end()) {
             _destroy(first.base(), _last);
             _last = first.base();
             return first;
         }
+        if (is_trivially_relocatable<T>::value) {
+            _destroy(first.base(), last.base());
+            _move_bytes(first.base(), last.base(), _last);
+            _last -= last - first;
+            return first;
+        }
         pointer new_last = std::copy(last.base(), _last, first.base());
         _destroy(new_last, _last);
         _last -= last - first;
@@ -330,21 +418,37 @@ class vector {
         pointer         pos_ptr(pos.base());
 
         if (n > static_cast<size_type>(_end_of_storage - _last)) {
-            size_type len(size() + std::max(n, size()));
+            size_type len(_grown_capacity(size() + n));
             pointer new_first(_allocate(len));
             pointer new_last(new_first);
 
-            try {
-                new_last = std::uninitialized_copy(_first, pos_ptr, new_first);
-                new_last = std::uninitialized_copy(first_ptr, last_ptr,
-                                                   new_last);
-                new_last = std::uninitialized_copy(pos_ptr, _last, new_last);
-            } catch (...) {
-                _destroy(new_first, new_last);
-                _allocator.deallocate(new_first, n);
-                throw;
+            if (is_trivially_relocatable<T>::value) {
+                pointer gap(new_first + (pos_ptr - _first));
+
+                try {
+                    std::uninitialized_copy(first_ptr, last_ptr, gap);
+                } catch (...) {
+                    _deallocate(new_first, len);
+                    throw;
+                }
+                _relocate(_first, pos_ptr, new_first);
+                new_last = _relocate(pos_ptr, _last, gap + n);
+                _deallocate(_first, capacity());
+            } else {
+                try {
+                    new_last = std::uninitialized_copy(_first, pos_ptr,
+                                                       new_first);
+                    new_last = std::uninitialized_copy(first_ptr, last_ptr,
+                                                       new_last);
+                    new_last = std::uninitialized_copy(pos_ptr, _last,
+                                                       new_last);
+                } catch (...) {
+                    _destroy(new_first, new_last);
+                    _deallocate(new_first, len);
+                    throw;
+                }
+                _full_destroy_and_deallocate();
             }
-            _full_destroy_and_deallocate();
             _first = new_first;
             _last = new_last;
             _end_of_storage = _first + len;
@@ -352,7 +456,16 @@ class vector {
             pointer     old_last(_last);
             size_type   pos_n(_last - pos_ptr);
 
-            if (pos_n > n) {
+            if (is_trivially_relocatable<T>::value) {
+                _move_bytes(pos_ptr + n, pos_ptr, _last);
+                try {
+                    std::uninitialized_copy(first_ptr, last_ptr, pos_ptr);
+                } catch (...) {
+                    _move_bytes(pos_ptr, pos_ptr + n, _last + n);
+                    throw;
+                }
+                _last += n;
+            } else if (pos_n > n) {
                 _last = std::uninitialized_copy(_last - n, _last, _last);
                 std::copy_backward(pos_ptr, old_last - n, old_last);
                 std::copy(first_ptr, last_ptr, pos_ptr);
@@ -387,56 +500,155 @@ class vector {
         }
     }
 
-    pointer _allocate(size_type n) {
+    size_type _grown_capacity(size_type required) const {
+        return GrowthPolicy::next_capacity(capacity(), required, max_size(),
+                                           sizeof(value_type));
+    }
+
+    void _check_length(size_type n) const {
         if (n > max_size()) {
             throw std::length_error(
                            "cannot create std::vector larger than max_size()");
         }
+    }
+
+    /**
+     * Trivially copyable elements of a vector using std::allocator live in
+     * malloc blocks instead, so that growing the vector is a realloc: the
+     * C library extends a large block by remapping its pages, or moves
+     * it without the elements being copied one by one.
+     */
+    static bool _reallocable(void) {
+        return is_trivially_copyable<T>::value
+               && is_same<AllocTp, std::allocator<T> >::value;
+    }
+
+    pointer _allocate(size_type n) {
+        _check_length(n);
+        if (_reallocable()) {
+            void*   block = std::malloc(n * sizeof(value_type));
+
+            if (!block && n) {
+                throw std::bad_alloc();
+            }
+            return static_cast<pointer>(block);
+        }
         return _allocator.allocate(n);
     }
 
+    void _deallocate(pointer p, size_type n) {
+        if (_reallocable()) {
+            std::free(p);
+        } else {
+            _allocator.deallocate(p, n);
+        }
+    }
+
+    /* On failure the old block, and so the vector, is left untouched. */
+    void _reallocate(size_type new_capacity) {
+        size_type   old_size(size());
+        void*       block;
+
+        _check_length(new_capacity);
+        block = std::realloc(static_cast<void*>(_first),
+                             new_capacity * sizeof(value_type));
+        if (!block) {
+            throw std::bad_alloc();
+        }
+        _first = static_cast<pointer>(block);
+        _last = _first + old_size;
+        _end_of_storage = _first + new_capacity;
+    }
+
     void _full_destroy_and_deallocate(void) {
         _destroy(_first, _last);
-        _allocator.deallocate(_first, capacity());
+        _deallocate(_first, capacity());
+    }
+
+    /**
+     * Moves [first, last) to the uninitialized storage at dest, ending the
+     * lifetime of the originals: a memmove when T is trivially relocatable,
+     * otherwise a copy of each element followed by its destruction.
+     */
+    pointer _relocate(pointer first, pointer last, pointer dest) {
+        if (is_trivially_relocatable<T>::value) {
+            _move_bytes(dest, first, last);
+            return dest + (last - first);
+        }
+        pointer dest_last = std::uninitialized_copy(first, last, dest);
+        _destroy(first, last);
+        return dest_last;
+    }
+
+    /* Only for trivially relocatable T: the ranges may overlap. */
+    static void _move_bytes(pointer dest, pointer first, pointer last) {
+        if (first != last) {
+            std::memmove(static_cast<void*>(dest),
+                         static_cast<const void*>(first),
+                         (last - first) * sizeof(value_type));
+        }
+    }
+
+    /**
+     * Where val is once [pos, _last) has been moved n slots to the right:
+     * an insertion may copy an element of the vector itself.
+     */
+    const value_type*   _shifted(const value_type* val, pointer pos,
+                                 size_type n) const {
+        if (val >= pos && val < _last) {
+            return val + n;
+        }
+        return val;
+    }
+
+    /* Whether it lies in [lo, hi], for the debug checks of iterators. */
+    static bool _within(iterator it, iterator lo, iterator hi) {
+        return lo.base() <= it.base() && it.base() <= hi.base();
     }
 }; /* class vector */
 
 /*                          Relational Operators                      */
 
-template <class T, class Alloc>
-bool  operator==(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator==(const vector<T, Alloc, Growth>& x,
+                 const vector<T, Alloc, Growth>& y) {
     return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
 }
 
-template <class T, class Alloc>
-bool  operator!=(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator!=(const vector<T, Alloc, Growth>& x,
+                 const vector<T, Alloc, Growth>& y) {
     return !(x == y);
 }
 
-template <class T, class Alloc>
-bool  operator<(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator<(const vector<T, Alloc, Growth>& x,
+                const vector<T, Alloc, Growth>& y) {
     return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <class T, class Alloc>
-bool  operator<=(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator<=(const vector<T, Alloc, Growth>& x,
+                 const vector<T, Alloc, Growth>& y) {
     return !(y < x);
 }
 
-template <class T, class Alloc>
-bool  operator>(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator>(const vector<T, Alloc, Growth>& x,
+                const vector<T, Alloc, Growth>& y) {
     return y < x;
 }
 
-template <class T, class Alloc>
-bool  operator>=(const vector<T, Alloc>& x, const vector<T, Alloc>& y) {
+template <class T, class Alloc, class Growth>
+bool  operator>=(const vector<T, Alloc, Growth>& x,
+                 const vector<T, Alloc, Growth>& y) {
     return !(x < y);
 }
 
 /*                          Non member functions                      */
 
-template<class T, class Alloc>
-void  swap(vector<T, Alloc>& x, vector<T, Alloc>& y) {
+template<class T, class Alloc, class Growth>
+void  swap(vector<T, Alloc, Growth>& x, vector<T, Alloc, Growth>& y) {
     x.swap(y);
 }
 
@@ -0,0 +1,201 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef FLAT_FLAT_STORAGE_HPP_
+#define FLAT_FLAT_STORAGE_HPP_
+
+#include <memory>
+
+#include "../containers/vector.hpp"
+#include "../utility/pair.hpp"
+#include "../iterators/zip_iter.hpp"
+
+namespace ft {
+
+/**
+ * Storage policies for flat_tree: the sorted elements of a flat_map or
+ * flat_set, kept in ft::vector. flat_tree reads keys by index through
+ * key(i) and key_of(), and only changes the sequence through insert(),
+ * erase(), push_back(), assign() and move().
+ */
+
+/* A flat_set's keys, in one vector. */
+template <typename Key, typename AllocTp = std::allocator<Key> >
+struct flat_key_storage {
+    typedef Key                                         key_type;
+    typedef Key                                         value_type;
+    typedef ft::vector<Key, AllocTp>                    container_type;
+    typedef typename container_type::iterator           iterator;
+    typedef typename container_type::const_iterator     const_iterator;
+    typedef std::size_t                                 size_type;
+
+    container_type  keys;
+
+    static const key_type&  key_of(const value_type& x) { return x; }
+
+    const key_type& key(size_type i) const { return keys[i]; }
+
+    iterator        begin(void) { return keys.begin(); }
+    iterator        end(void) { return keys.end(); }
+    const_iterator  begin(void) const { return keys.begin(); }
+    const_iterator  end(void) const { return keys.end(); }
+
+    size_type   size(void) const { return keys.size(); }
+    size_type   max_size(void) const { return keys.max_size(); }
+    size_type   capacity(void) const { return keys.capacity(); }
+    void        reserve(size_type n) { keys.reserve(n); }
+    void        clear(void) { keys.clear(); }
+    void        swap(flat_key_storage& x) { keys.swap(x.keys); }
+
+    void    insert(size_type i, const value_type& x) {
+        keys.insert(keys.begin() + i, x);
+    }
+
+    void    erase(size_type first, size_type last) {
+        keys.erase(keys.begin() + first, keys.begin() + last);
+    }
+
+    void    push_back(const value_type& x) { keys.push_back(x); }
+    void    assign(size_type i, const value_type& x) { keys[i] = x; }
+    void    move(size_type to, size_type from) { keys[to] = keys[from]; }
+};  /* struct flat_key_storage */
+
+/**
+ * The default flat_map storage: each key next to its mapped value, in one
+ * vector of pairs. Keys are not const in there, since the vector shifts
+ * elements by assignment; they must not be changed through an iterator.
+ */
+template <typename Key, typename T,
+          typename AllocTp = std::allocator<ft::pair<Key, T> > >
+struct flat_pair_storage {
+    typedef Key                                         key_type;
+    typedef T                                           mapped_type;
+    typedef ft::pair<Key, T>                            value_type;
+    typedef ft::vector<value_type, AllocTp>             container_type;
+    typedef typename container_type::iterator           iterator;
+    typedef typename container_type::const_iterator     const_iterator;
+    typedef std::size_t                                 size_type;
+
+    container_type  values;
+
+    static const key_type&  key_of(const value_type& x) { return x.first; }
+
+    const key_type& key(size_type i) const { return values[i].first; }
+    mapped_type&    mapped(size_type i) { return values[i].second; }
+
+    iterator        begin(void) { return values.begin(); }
+    iterator        end(void) { return values.end(); }
+    const_iterator  begin(void) const { return values.begin(); }
+    const_iterator  end(void) const { return values.end(); }
+
+    size_type   size(void) const { return values.size(); }
+    size_type   max_size(void) const { return values.max_size(); }
+    size_type   capacity(void) const { return values.capacity(); }
+    void        reserve(size_type n) { values.reserve(n); }
+    void        clear(void) { values.clear(); }
+    void        swap(flat_pair_storage& x) { values.swap(x.values); }
+
+    void    insert(size_type i, const value_type& x) {
+        values.insert(values.begin() + i, x);
+    }
+
+    void    erase(size_type first, size_type last) {
+        values.erase(values.begin() + first, values.begin() + last);
+    }
+
+    void    push_back(const value_type& x) { values.push_back(x); }
+    void    assign(size_type i, const value_type& x) { values[i] = x; }
+    void    move(size_type to, size_type from) { values[to] = values[from]; }
+};  /* struct flat_pair_storage */
+
+/**
+ * Split flat_map storage: keys in one vector and mapped values in a
+ * parallel one, so binary searches only walk densely packed keys. Its
+ * iterators are ft::zip_iter, yielding pairs of references.
+ */
+template <typename Key, typename T,
+          typename KeyAlloc = std::allocator<Key>,
+          typename MappedAlloc = std::allocator<T> >
+struct flat_split_storage {
+    typedef Key                                         key_type;
+    typedef T                                           mapped_type;
+    typedef ft::pair<Key, T>                            value_type;
+    typedef ft::zip_iter<Key, T*>                       iterator;
+    typedef ft::zip_iter<Key, const T*>                 const_iterator;
+    typedef std::size_t                                 size_type;
+
+    ft::vector<Key, KeyAlloc>       keys;
+    ft::vector<T, MappedAlloc>      mapped_values;
+
+    static const key_type&  key_of(const value_type& x) { return x.first; }
+
+    const key_type& key(size_type i) const { return keys[i]; }
+    mapped_type&    mapped(size_type i) { return mapped_values[i]; }
+
+    iterator        begin(void) {
+        return iterator(keys.data(), mapped_values.data());
+    }
+    iterator        end(void) { return begin() + keys.size(); }
+    const_iterator  begin(void) const {
+        return const_iterator(keys.data(), mapped_values.data());
+    }
+    const_iterator  end(void) const { return begin() + keys.size(); }
+
+    size_type   size(void) const { return keys.size(); }
+    size_type   max_size(void) const { return keys.max_size(); }
+    size_type   capacity(void) const { return keys.capacity(); }
+
+    void        reserve(size_type n) {
+        keys.reserve(n);
+        mapped_values.reserve(n);
+    }
+
+    void        clear(void) {
+        keys.clear();
+        mapped_values.clear();
+    }
+
+    void        swap(flat_split_storage& x) {
+        keys.swap(x.keys);
+        mapped_values.swap(x.mapped_values);
+    }
+
+    void    insert(size_type i, const value_type& x) {
+        keys.insert(keys.begin() + i, x.first);
+        try {
+            mapped_values.insert(mapped_values.begin() + i, x.second);
+        } catch (...) {
+            keys.erase(keys.begin() + i);
+            throw;
+        }
+    }
+
+    void    erase(size_type first, size_type last) {
+        keys.erase(keys.begin() + first, keys.begin() + last);
+        mapped_values.erase(mapped_values.begin() + first,
+                            mapped_values.begin() + last);
+    }
+
+    void    push_back(const value_type& x) {
+        keys.push_back(x.first);
+        try {
+            mapped_values.push_back(x.second);
+        } catch (...) {
+            keys.pop_back();
+            throw;
+        }
+    }
+
+    void    assign(size_type i, const value_type& x) {
+        keys[i] = x.first;
+        mapped_values[i] = x.second;
+    }
+
+    void    move(size_type to, size_type from) {
+        keys[to] = keys[from];
+        mapped_values[to] = mapped_values[from];
+    }
+};  /* struct flat_split_storage */
+
+}   /* namespace ft */
+
+#endif  /* FLAT_FLAT_STORAGE_HPP_ */
@@ -0,0 +1,221 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef FLAT_FLAT_TREE_HPP_
+#define FLAT_FLAT_TREE_HPP_
+
+#include <algorithm>
+
+#include "../containers/vector.hpp"
+#include "../utility/pair.hpp"
+#include "./flat_storage.hpp"
+
+namespace ft {
+
+/**
+ * Sorted sequence behind ft::flat_map and ft::flat_set, kept contiguous by
+ * a storage policy (see flat_storage.hpp). Lookups binary-search the keys;
+ * inserting or erasing one element shifts everything after it, which
+ * suits containers built once, or in bulk, then read many times. Any
+ * insertion or erasure invalidates iterators.
+ */
+template <typename Storage, typename Compare>
+class flat_tree {
+ public:
+    typedef typename Storage::key_type                  key_type;
+    typedef typename Storage::value_type                value_type;
+    typedef typename Storage::iterator                  iterator;
+    typedef typename Storage::const_iterator            const_iterator;
+    typedef std::size_t                                 size_type;
+    typedef Compare                                     key_compare;
+
+    explicit flat_tree(const key_compare& comp) : _comp(comp), _storage() {}
+
+    void    swap(flat_tree& x) {
+        key_compare tmp(_comp);
+
+        _comp = x._comp;
+        x._comp = tmp;
+        _storage.swap(x._storage);
+    }
+
+    Storage&        storage(void) { return _storage; }
+    const Storage&  storage(void) const { return _storage; }
+
+    iterator        begin(void) { return _storage.begin(); }
+    iterator        end(void) { return _storage.end(); }
+    const_iterator  begin(void) const { return _storage.begin(); }
+    const_iterator  end(void) const { return _storage.end(); }
+
+    size_type   size(void) const { return _storage.size(); }
+    size_type   max_size(void) const { return _storage.max_size(); }
+    size_type   capacity(void) const { return _storage.capacity(); }
+    void        reserve(size_type n) { _storage.reserve(n); }
+    void        clear(void) { _storage.clear(); }
+
+    /* The index of the first key not less than key, searching from. */
+    template <typename K>
+    size_type   lower_index(const K& key, size_type from = 0) const {
+        size_type   high = _storage.size();
+
+        while (from < high) {
+            size_type   middle = from + (high - from) / 2;
+
+            if (_comp(_storage.key(middle), key)) {
+                from = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return from;
+    }
+
+    template <typename K>
+    size_type   upper_index(const K& key) const {
+        size_type   low = 0;
+        size_type   high = _storage.size();
+
+        while (low < high) {
+            size_type   middle = low + (high - low) / 2;
+
+            if (_comp(key, _storage.key(middle))) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        return low;
+    }
+
+    /* The index of key, or size() when it is not here. */
+    template <typename K>
+    size_type   index_of(const K& key) const {
+        size_type   i = lower_index(key);
+
+        if (i == _storage.size() || _comp(key, _storage.key(i))) {
+            return _storage.size();
+        }
+        return i;
+    }
+
+    ft::pair<size_type, bool>   insert_unique(const value_type& value) {
+        const key_type& key = Storage::key_of(value);
+        size_type       i = lower_index(key);
+
+        if (i < _storage.size() && !_comp(key, _storage.key(i))) {
+            return ft::make_pair(i, false);
+        }
+        _storage.insert(i, value);
+        return ft::make_pair(i, true);
+    }
+
+    /* Skips the search when value belongs right before index hint. */
+    size_type   insert_unique(size_type hint, const value_type& value) {
+        const key_type& key = Storage::key_of(value);
+
+        if ((hint == 0 || _comp(_storage.key(hint - 1), key))
+            && (hint == _storage.size() || _comp(key, _storage.key(hint)))) {
+            _storage.insert(hint, value);
+            return hint;
+        }
+        return insert_unique(value).first;
+    }
+
+    /**
+     * Sort and merge: the new elements are sorted apart, stripped of the
+     * keys already here, appended, and merged backwards into place. Each
+     * element already stored moves at most once, so this is
+     * O(m log(n + m) + n) instead of m shifting insertions.
+     */
+    template <typename InputIt>
+    void    insert_range(InputIt first, InputIt last) {
+        ft::vector<value_type>  incoming;
+
+        for (; first != last; ++first) {
+            incoming.push_back(*first);
+        }
+        size_type   count = _sort_new_keys(&incoming);
+        size_type   stored = _storage.size();
+
+        _storage.reserve(stored + count);
+        for (size_type j = 0; j < count; ++j) {
+            _storage.push_back(incoming[j]);
+        }
+        if (!stored || !count || _comp(_storage.key(stored - 1),
+                                       Storage::key_of(incoming[0]))) {
+            return;
+        }
+        size_type   to = stored + count;
+
+        while (count) {
+            if (stored && _comp(Storage::key_of(incoming[count - 1]),
+                                _storage.key(stored - 1))) {
+                _storage.move(--to, --stored);
+            } else {
+                _storage.assign(--to, incoming[--count]);
+            }
+        }
+    }
+
+    void    erase(size_type first, size_type last) {
+        _storage.erase(first, last);
+    }
+
+    template <typename K>
+    size_type   remove(const K& key) {
+        size_type   i = index_of(key);
+
+        if (i == _storage.size()) {
+            return 0;
+        }
+        _storage.erase(i, i + 1);
+        return 1;
+    }
+
+ private:
+    struct _value_less {
+        key_compare comp;
+
+        explicit _value_less(const key_compare& c) : comp(c) {}
+
+        bool    operator()(const value_type& x, const value_type& y) const {
+            return comp(Storage::key_of(x), Storage::key_of(y));
+        }
+    };
+
+    key_compare _comp;
+    Storage     _storage;
+
+    /**
+     * Stable-sorts incoming and packs at its front the elements to insert:
+     * the first of each run of equivalent keys, unless the key is already
+     * stored. Returns how many there are.
+     */
+    size_type   _sort_new_keys(ft::vector<value_type>* incoming) const {
+        value_type* values = incoming->data();
+        size_type   kept = 0;
+        size_type   from = 0;
+
+        std::stable_sort(values, values + incoming->size(),
+                         _value_less(_comp));
+        for (size_type j = 0; j < incoming->size(); ++j) {
+            const key_type& key = Storage::key_of(values[j]);
+
+            if (kept && !_comp(Storage::key_of(values[kept - 1]), key)) {
+                continue;
+            }
+            from = lower_index(key, from);
+            if (from < _storage.size() && !_comp(key, _storage.key(from))) {
+                continue;
+            }
+            if (kept != j) {
+                values[kept] = values[j];
+            }
+            ++kept;
+        }
+        return kept;
+    }
+};  /* class flat_tree */
+
+}   /* namespace ft */
+
+#endif  /* FLAT_FLAT_TREE_HPP_ */
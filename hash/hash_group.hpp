@@ -0,0 +1,118 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef HASH_HASH_GROUP_HPP_
+#define HASH_HASH_GROUP_HPP_
+
+#include <cstddef>
+
+#if defined(__SSE2__) && !defined(FT_HASH_NO_SSE2)
+    #include <emmintrin.h>
+    #define FT_HASH_SSE2 1
+#endif
+
+namespace ft {
+
+/**
+ * Every slot of a hash_table has a control byte. A full slot's byte holds
+ * seven bits of its value's hash, from 0 to 127; the negative values below
+ * mark free slots and the end of the table, so that "empty or deleted" is
+ * any byte less than hash_ctrl_sentinel.
+ */
+typedef signed char         hash_ctrl;
+
+static const hash_ctrl      hash_ctrl_empty = -128;
+static const hash_ctrl      hash_ctrl_deleted = -2;
+static const hash_ctrl      hash_ctrl_sentinel = -1;
+
+/* A set of slots in a group, one bit per slot, lowest slot first. */
+class hash_bitmask {
+ public:
+    explicit hash_bitmask(unsigned int mask) : _mask(mask) {}
+
+    bool        any(void) const { return _mask != 0; }
+
+    std::size_t lowest(void) const {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctz(_mask));
+#else
+        std::size_t i = 0;
+
+        while (!(_mask >> i & 1)) {
+            ++i;
+        }
+        return i;
+#endif
+    }
+
+    void        clear_lowest(void) { _mask &= _mask - 1; }
+
+ private:
+    unsigned int    _mask;
+};  /* class hash_bitmask */
+
+/**
+ * The control bytes of `width` consecutive slots, matched all at once: with
+ * SSE2, one 16-byte load and one comparison answer for the whole group.
+ * Defining FT_HASH_NO_SSE2 forces the portable loop, which gives the same
+ * answers one byte at a time.
+ */
+class hash_group {
+ public:
+    static const std::size_t    width = 16;
+
+    explicit hash_group(const hash_ctrl* ctrl)
+#ifdef FT_HASH_SSE2
+        :   _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+#else
+        :   _ctrl(ctrl) {}
+#endif
+
+    /* The full slots whose byte is h2. */
+    hash_bitmask    match(hash_ctrl h2) const {
+#ifdef FT_HASH_SSE2
+        return _match_mask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl));
+#else
+        unsigned int    mask = 0;
+
+        for (std::size_t i = 0; i < width; ++i) {
+            mask |= static_cast<unsigned int>(_ctrl[i] == h2) << i;
+        }
+        return hash_bitmask(mask);
+#endif
+    }
+
+    hash_bitmask    match_empty(void) const {
+        return match(hash_ctrl_empty);
+    }
+
+    hash_bitmask    match_empty_or_deleted(void) const {
+#ifdef FT_HASH_SSE2
+        return _match_mask(_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl_sentinel),
+                                          _ctrl));
+#else
+        unsigned int    mask = 0;
+
+        for (std::size_t i = 0; i < width; ++i) {
+            mask |= static_cast<unsigned int>(_ctrl[i] < hash_ctrl_sentinel)
+                        << i;
+        }
+        return hash_bitmask(mask);
+#endif
+    }
+
+ private:
+#ifdef FT_HASH_SSE2
+    __m128i             _ctrl;
+
+    static hash_bitmask _match_mask(__m128i matches) {
+        return hash_bitmask(
+                    static_cast<unsigned int>(_mm_movemask_epi8(matches)));
+    }
+#else
+    const hash_ctrl*    _ctrl;
+#endif
+};  /* class hash_group */
+
+}   /* namespace ft */
+
+#endif  /* HASH_HASH_GROUP_HPP_ */
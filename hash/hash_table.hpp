@@ -0,0 +1,470 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef HASH_HASH_TABLE_HPP_
+#define HASH_HASH_TABLE_HPP_
+
+#include <cstring>
+#include <memory>
+
+#include "../utility/pair.hpp"
+#include "./hash_group.hpp"
+#include "../iterators/hash_iter.hpp"
+
+namespace ft {
+
+/**
+ * Open-addressing hash table behind ft::unordered_map and
+ * ft::unordered_set, laid out as in Swiss tables: values sit directly in
+ * one array of slots, and a parallel array of control bytes tells which
+ * slots are full and seven bits of their hash. A lookup probes groups of
+ * sixteen slots, matching the control bytes of a whole group at once
+ * before comparing any key, and stops at the first group with an empty
+ * slot. Values never move but when the table grows: only rehashing
+ * invalidates iterators, and erasing only the erased element's.
+ */
+template <typename key_type,
+          typename value_type,
+          typename KeyOfValue,
+          typename Hash,
+          typename KeyEqual,
+          typename AllocTp = std::allocator<value_type> >
+class hash_table {
+    typedef typename AllocTp::template
+                    rebind<hash_ctrl>::other            ctrl_allocator;
+
+ public:
+    typedef size_t                                      size_type;
+    typedef ptrdiff_t                                   difference_type;
+    typedef value_type&                                 reference;
+    typedef const value_type&                           const_reference;
+    typedef value_type*                                 pointer;
+    typedef const value_type*                           const_pointer;
+    typedef Hash                                        hasher;
+    typedef KeyEqual                                    key_equal;
+
+    typedef ft::hash_iter<pointer>                      iterator;
+    typedef ft::hash_iter<const_pointer>                const_iterator;
+
+    hash_table(size_type bucket_count, const hasher& hash,
+               const key_equal& equal, const AllocTp& allocator = AllocTp())
+            :   _size(0),
+                _capacity(0),
+                _growth_left(0),
+                _hash(hash),
+                _equal(equal),
+                _value_allocator(allocator),
+                _ctrl_allocator(allocator),
+                _ctrl(0),
+                _slots(0) {
+        rehash(bucket_count);
+    }
+
+    hash_table(const hash_table& src)
+            :   _size(0),
+                _capacity(0),
+                _growth_left(0),
+                _hash(src._hash),
+                _equal(src._equal),
+                _value_allocator(src._value_allocator),
+                _ctrl_allocator(src._ctrl_allocator),
+                _ctrl(0),
+                _slots(0) {
+        *this = src;
+    }
+
+    ~hash_table() { _release(); }
+
+    /**
+     * With the same hasher, every value belongs in the same slot as in
+     * src: the control bytes are copied as they are and nothing is hashed.
+     */
+    hash_table& operator=(const hash_table& src) {
+        if (&src == this) {
+            return *this;
+        }
+        _release();
+        _hash = src._hash;
+        _equal = src._equal;
+        if (!src._size) {
+            return *this;
+        }
+        _allocate(src._capacity);
+        std::memcpy(_ctrl, src._ctrl, _capacity + 1);
+        for (size_type i = 0; i < _capacity; ++i) {
+            if (!_is_full(_ctrl[i])) {
+                continue;
+            }
+            try {
+                _value_allocator.construct(_slots + i, src._slots[i]);
+            } catch (...) {
+                std::memset(_ctrl + i, hash_ctrl_empty, _capacity - i);
+                _release();
+                throw;
+            }
+            ++_size;
+        }
+        _growth_left = src._growth_left;
+        return *this;
+    }
+
+    void swap(hash_table& src) {
+        _swap(_size, src._size);
+        _swap(_capacity, src._capacity);
+        _swap(_growth_left, src._growth_left);
+        _swap(_hash, src._hash);
+        _swap(_equal, src._equal);
+        _swap(_value_allocator, src._value_allocator);
+        _swap(_ctrl_allocator, src._ctrl_allocator);
+        _swap(_ctrl, src._ctrl);
+        _swap(_slots, src._slots);
+    }
+
+    size_type   size(void) const { return _size; }
+    size_type   max_size(void) const { return _value_allocator.max_size(); }
+    size_type   capacity(void) const { return _capacity; }
+    AllocTp     get_allocator(void) const { return _value_allocator; }
+    hasher      hash_function(void) const { return _hash; }
+    key_equal   key_eq(void) const { return _equal; }
+
+    iterator        begin(void) const {
+        if (!_size) {
+            return _end();
+        }
+        size_type   i = 0;
+
+        while (!_is_full(_ctrl[i])) {
+            ++i;
+        }
+        return iterator(_ctrl + i, _slots + i);
+    }
+
+    iterator        end(void) const { return _end(); }
+
+    /**
+     * Lookups return a mutable iterator even on a const table; the
+     * containers hand it out as a const_iterator where they have to.
+     */
+    iterator    find(const key_type& key) const {
+        if (!_size) {
+            return _end();
+        }
+        return _find(key, _hash_of(key));
+    }
+
+    /* Hashes and probes once: a miss ends where the value can go. */
+    ft::pair<iterator, bool>    insert_unique(const value_type& value) {
+        const key_type& key = KeyOfValue()(value);
+        size_type       h = _hash_of(key);
+        size_type       slot = 0;
+
+        if (_capacity) {
+            iterator    found = _find(key, h, &slot);
+
+            if (found != _end()) {
+                return ft::make_pair(found, false);
+            }
+        }
+        return ft::make_pair(_insert_new(value, h, slot), true);
+    }
+
+    /**
+     * Like insert_unique, but the value, make(key), is only built when
+     * key is missing, as operator[] needs.
+     */
+    template <typename Make>
+    ft::pair<iterator, bool>    find_or_insert(const key_type& key,
+                                               Make make) {
+        size_type   h = _hash_of(key);
+        size_type   slot = 0;
+
+        if (_capacity) {
+            iterator    found = _find(key, h, &slot);
+
+            if (found != _end()) {
+                return ft::make_pair(found, false);
+            }
+        }
+        return ft::make_pair(_insert_new(make(key), h, slot), true);
+    }
+
+    template <typename InputIt>
+    void    insert_range(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert_unique(*first);
+        }
+    }
+
+    /**
+     * The slot goes back to empty when its group still has an empty slot:
+     * no probe ever went past that group. Otherwise it becomes a
+     * tombstone, which probes skip and insertions reuse.
+     */
+    void    erase(const_iterator pos) {
+        size_type   i = pos.ctrl() - _ctrl;
+        size_type   group = i - i % hash_group::width;
+
+        _value_allocator.destroy(_slots + i);
+        --_size;
+        if (hash_group(_ctrl + group).match_empty().any()) {
+            _ctrl[i] = hash_ctrl_empty;
+            ++_growth_left;
+        } else {
+            _ctrl[i] = hash_ctrl_deleted;
+        }
+    }
+
+    /* Erasing moves nothing, so the range can be walked as it goes. */
+    void    erase(const_iterator first, const_iterator last) {
+        if (first == begin() && last == end()) {
+            clear();
+            return;
+        }
+        while (first != last) {
+            erase(first++);
+        }
+    }
+
+    size_type   remove(const key_type& key) {
+        iterator    pos = find(key);
+
+        if (pos == _end()) {
+            return 0;
+        }
+        erase(pos);
+        return 1;
+    }
+
+    /* Keeps the slots, like a vector keeps its capacity. */
+    void    clear(void) {
+        _destroy_values();
+        if (_capacity) {
+            std::memset(_ctrl, hash_ctrl_empty, _capacity);
+        }
+        _size = 0;
+        _growth_left = _max_load(_capacity);
+    }
+
+    /**
+     * Rebuilds the table with at least bucket_count slots, and at least
+     * enough for its elements, dropping every tombstone on the way.
+     */
+    void    rehash(size_type bucket_count) {
+        size_type   capacity = _capacity_for(_size);
+
+        while (capacity < bucket_count) {
+            capacity *= 2;
+        }
+        if (!_size && !bucket_count) {
+            _release();
+        } else if (capacity != _capacity
+                   || _growth_left != _max_load(_capacity) - _size) {
+            _resize(capacity);
+        }
+    }
+
+    /* Makes room for count elements without growing again. */
+    void    reserve(size_type count) {
+        if (count > _size + _growth_left) {
+            _resize(_capacity_for(count));
+        }
+    }
+
+ private:
+    size_type           _size;
+    size_type           _capacity;
+    size_type           _growth_left;
+    hasher              _hash;
+    key_equal           _equal;
+    AllocTp             _value_allocator;
+    ctrl_allocator      _ctrl_allocator;
+    hash_ctrl*          _ctrl;
+    pointer             _slots;
+
+    template <typename U>
+    static void     _swap(U& x, U& y) {
+        U   tmp(x);
+
+        x = y;
+        y = tmp;
+    }
+
+    static bool     _is_full(hash_ctrl ctrl) { return ctrl >= 0; }
+
+    /* Tables are at most 7/8 full, so every probe meets an empty slot. */
+    static size_type    _max_load(size_type capacity) {
+        return capacity - capacity / 8;
+    }
+
+    /* The smallest capacity, a power of two, that holds count elements. */
+    static size_type    _capacity_for(size_type count) {
+        size_type   capacity = hash_group::width;
+
+        while (_max_load(capacity) < count) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /**
+     * Scrambles the user's hash, since identity hashes of integers are
+     * common: the low seven bits go to the control byte, the rest pick
+     * the first group to probe.
+     */
+    size_type   _hash_of(const key_type& key) const {
+        size_type   h = _hash(key);
+
+        h *= static_cast<size_type>(0x9E3779B97F4A7C15ULL);
+        return h ^ (h >> (sizeof(size_type) * 4));
+    }
+
+    static hash_ctrl    _h2(size_type h) {
+        return static_cast<hash_ctrl>(h & 0x7F);
+    }
+
+    iterator    _end(void) const {
+        return iterator(_ctrl + _capacity, _slots + _capacity);
+    }
+
+    /**
+     * The groups of a table are probed in triangular steps, 1, 2, 3...
+     * groups apart, which visits each of them once as the group count is
+     * a power of two. Given free, it also records the first empty or
+     * deleted slot on the way, where a missing key would be inserted.
+     */
+    iterator    _find(const key_type& key, size_type h,
+                      size_type* free = 0) const {
+        const size_type mask = _capacity / hash_group::width - 1;
+        size_type       group = (h >> 7) & mask;
+
+        for (size_type step = 1; ; ++step) {
+            size_type   first = group * hash_group::width;
+            hash_group  g(_ctrl + first);
+
+            for (hash_bitmask m = g.match(_h2(h)); m.any(); m.clear_lowest()) {
+                size_type   i = first + m.lowest();
+
+                if (_equal(key, KeyOfValue()(_slots[i]))) {
+                    return iterator(_ctrl + i, _slots + i);
+                }
+            }
+            if (free) {
+                hash_bitmask    room = g.match_empty_or_deleted();
+
+                if (room.any()) {
+                    *free = first + room.lowest();
+                    free = 0;
+                }
+            }
+            if (g.match_empty().any()) {
+                return _end();
+            }
+            group = (group + step) & mask;
+        }
+    }
+
+    /* The first empty or deleted slot on h's probe sequence. */
+    static size_type    _free_slot(const hash_ctrl* ctrl, size_type capacity,
+                                   size_type h) {
+        const size_type mask = capacity / hash_group::width - 1;
+        size_type       group = (h >> 7) & mask;
+
+        for (size_type step = 1; ; ++step) {
+            size_type       first = group * hash_group::width;
+            hash_bitmask    m = hash_group(ctrl + first)
+                                    .match_empty_or_deleted();
+
+            if (m.any()) {
+                return first + m.lowest();
+            }
+            group = (group + step) & mask;
+        }
+    }
+
+    /**
+     * Puts value in slot i, the free slot a probe for h found. Reusing a
+     * tombstone costs no growth; filling an empty slot when none are left
+     * to fill rehashes first, into twice the slots, or the same number
+     * when tombstones took most of them.
+     */
+    iterator    _insert_new(const value_type& value, size_type h,
+                            size_type i) {
+        if (!_capacity
+            || (!_growth_left && _ctrl[i] != hash_ctrl_deleted)) {
+            _resize(_size <= _max_load(_capacity) / 2
+                        ? _capacity_for(_size + 1) : _capacity * 2);
+            i = _free_slot(_ctrl, _capacity, h);
+        }
+        _value_allocator.construct(_slots + i, value);
+        if (_ctrl[i] == hash_ctrl_empty) {
+            --_growth_left;
+        }
+        _ctrl[i] = _h2(h);
+        ++_size;
+        return iterator(_ctrl + i, _slots + i);
+    }
+
+    /*                      Storage management                  */
+
+    /* Empty arrays for capacity slots, and the sentinel after them. */
+    void    _allocate(size_type capacity) {
+        _ctrl = _ctrl_allocator.allocate(capacity + 1);
+        try {
+            _slots = _value_allocator.allocate(capacity);
+        } catch (...) {
+            _ctrl_allocator.deallocate(_ctrl, capacity + 1);
+            _ctrl = 0;
+            throw;
+        }
+        std::memset(_ctrl, hash_ctrl_empty, capacity);
+        _ctrl[capacity] = hash_ctrl_sentinel;
+        _capacity = capacity;
+        _growth_left = _max_load(capacity);
+    }
+
+    void    _destroy_values(void) {
+        for (size_type i = 0; _size && i < _capacity; ++i) {
+            if (_is_full(_ctrl[i])) {
+                _value_allocator.destroy(_slots + i);
+            }
+        }
+    }
+
+    void    _release(void) {
+        _destroy_values();
+        if (_ctrl) {
+            _ctrl_allocator.deallocate(_ctrl, _capacity + 1);
+            _value_allocator.deallocate(_slots, _capacity);
+        }
+        _size = _capacity = _growth_left = 0;
+        _ctrl = 0;
+        _slots = 0;
+    }
+
+    /**
+     * Copies every value into a new table of capacity slots. The old one
+     * stays untouched until they are all in, so a throwing copy or hash
+     * leaves the table as it was.
+     */
+    void    _resize(size_type capacity) {
+        hash_table  grown(0, _hash, _equal, _value_allocator);
+
+        grown._allocate(capacity);
+        for (size_type i = 0; i < _capacity; ++i) {
+            if (!_is_full(_ctrl[i])) {
+                continue;
+            }
+            size_type   h = _hash_of(KeyOfValue()(_slots[i]));
+            size_type   j = _free_slot(grown._ctrl, capacity, h);
+
+            _value_allocator.construct(grown._slots + j, _slots[i]);
+            grown._ctrl[j] = _h2(h);
+            ++grown._size;
+        }
+        grown._growth_left -= grown._size;
+        swap(grown);
+    }
+};  /* class hash_table */
+
+}   /* namespace ft */
+
+#endif  /* HASH_HASH_TABLE_HPP_ */
@@ -0,0 +1,110 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef ITERATORS_BTREE_ITER_HPP_
+#define ITERATORS_BTREE_ITER_HPP_
+
+#include "./iterator_traits.hpp"
+#include "../btree/btree_node.hpp"
+
+namespace ft {
+
+/**
+ * A B-tree position is a node and a slot in it. end() is one past the last
+ * slot of the rightmost leaf, so it can be decremented like any other.
+ */
+template <typename T,
+          typename Node = ft::btree_node<
+                            typename ft::iterator_traits<T>::value_type> >
+class btree_iter {
+    typedef ft::iterator_traits<T>                      _iter_traits;
+
+ public:
+    typedef T                                           iterator_type;
+    typedef std::bidirectional_iterator_tag             iterator_category;
+    typedef typename _iter_traits::value_type           value_type;
+    typedef typename _iter_traits::difference_type      difference_type;
+    typedef typename _iter_traits::reference            reference;
+    typedef typename _iter_traits::pointer              pointer;
+
+ protected:
+    typedef Node                                        node_base;
+    typedef node_base*                                  node_pointer;
+    typedef const node_base*                            const_node_pointer;
+    typedef typename node_base::size_type               size_type;
+
+    node_pointer    _node;
+    size_type       _position;
+
+ public:
+    btree_iter() : _node(), _position() {}
+
+    btree_iter(node_pointer x, size_type i) : _node(x), _position(i) {}
+
+    btree_iter(const_node_pointer x, size_type i)
+            :   _node(const_cast<node_pointer>(x)),
+                _position(i) {}
+
+    btree_iter(const btree_iter& x)
+            :   _node(x.base()),
+                _position(x.position()) {}
+
+    template <typename U>
+    btree_iter(const btree_iter<U, Node>& x)
+            :   _node(x.base()),
+                _position(x.position()) {}
+
+    ~btree_iter() {}
+
+    /*                   Assignment operator                    */
+
+    btree_iter&     operator=(const btree_iter& rhs) {
+        _node = rhs.base();
+        _position = rhs.position();
+        return *this;
+    }
+
+    /*                   Accessors operators                    */
+
+    reference       operator*(void) const { return _node->value(_position); }
+    pointer         operator->(void) const {
+        return &_node->value(_position);
+    }
+    node_pointer    base(void) const { return _node; }
+    size_type       position(void) const { return _position; }
+
+    /*                   Increment operators                    */
+
+    btree_iter&     operator++(void) {
+        node_base::increment(_node, _position);
+        return *this;
+    }
+    btree_iter      operator++(int) {
+        btree_iter  tmp(*this);
+        node_base::increment(_node, _position);
+        return tmp;
+    }
+
+    /*                   Decrement operators                    */
+
+    btree_iter&     operator--(void) {
+        node_base::decrement(_node, _position);
+        return *this;
+    }
+    btree_iter      operator--(int) {
+        btree_iter  tmp(*this);
+        node_base::decrement(_node, _position);
+        return tmp;
+    }
+
+    bool operator==(const btree_iter& rhs) const {
+        return _node == rhs._node && _position == rhs._position;
+    }
+
+    bool operator!=(const btree_iter& rhs) const {
+        return !(*this == rhs);
+    }
+};  /* class btree_iter */
+
+}   /* namespace ft */
+
+#endif  /* ITERATORS_BTREE_ITER_HPP_ */
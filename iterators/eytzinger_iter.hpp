@@ -0,0 +1,186 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef ITERATORS_EYTZINGER_ITER_HPP_
+#define ITERATORS_EYTZINGER_ITER_HPP_
+
+#include <cstddef>
+
+#include "./iterator_traits.hpp"
+
+namespace ft {
+
+/**
+ * Navigation in an Eytzinger layout: a complete binary search tree stored
+ * breadth-first in slots 1 to size, where slot k has its children in
+ * slots 2k and 2k + 1. Slot 0 is unused and stands for end().
+ */
+struct eytzinger_layout {
+    typedef std::size_t size_type;
+
+    /* The slot of the smallest value, the leftmost one. */
+    static size_type    first(size_type size) {
+        size_type   k = size ? 1 : 0;
+
+        while (k && 2 * k <= size) {
+            k *= 2;
+        }
+        return k;
+    }
+
+    static size_type    last(size_type size) {
+        size_type   k = size ? 1 : 0;
+
+        while (k && 2 * k + 1 <= size) {
+            k = 2 * k + 1;
+        }
+        return k;
+    }
+
+    /**
+     * The in-order successor of slot k: the leftmost slot of its right
+     * subtree, or else the first ancestor it is on the left of. Past the
+     * last value this climbs to 0.
+     */
+    static size_type    next(size_type k, size_type size) {
+        if (2 * k + 1 <= size) {
+            k = 2 * k + 1;
+            while (2 * k <= size) {
+                k *= 2;
+            }
+            return k;
+        }
+        return up_from_right(k);
+    }
+
+    /* The in-order predecessor of slot k; from 0, the last slot. */
+    static size_type    prev(size_type k, size_type size) {
+        if (!k) {
+            return last(size);
+        }
+        if (2 * k <= size) {
+            k = 2 * k;
+            while (2 * k + 1 <= size) {
+                k = 2 * k + 1;
+            }
+            return k;
+        }
+        while (k && !(k & 1)) {
+            k >>= 1;
+        }
+        return k >> 1;
+    }
+
+    /**
+     * Undoes the right turns at the bottom of a descent, then the last
+     * left one: k >> (trailing ones + 1), the slot where the search
+     * last went left, or 0 if it never did.
+     */
+    static size_type    up_from_right(size_type k) {
+#if defined(__GNUC__) || defined(__clang__)
+        return k >> (__builtin_ctzl(static_cast<unsigned long>(~k)) + 1);
+#else
+        while (k & 1) {
+            k >>= 1;
+        }
+        return k >> 1;
+#endif
+    }
+};  /* struct eytzinger_layout */
+
+/**
+ * Walks an Eytzinger array in sorted order. Each step moves down to the
+ * leftmost slot of a right subtree or up past the ancestors on its right,
+ * which is constant time on average over a whole traversal.
+ */
+template <typename T>
+class eytzinger_iter {
+    typedef ft::iterator_traits<T>                      _iter_traits;
+
+ public:
+    typedef T                                           iterator_type;
+    typedef std::bidirectional_iterator_tag             iterator_category;
+    typedef typename _iter_traits::value_type           value_type;
+    typedef typename _iter_traits::difference_type      difference_type;
+    typedef typename _iter_traits::reference            reference;
+    typedef typename _iter_traits::pointer              pointer;
+    typedef std::size_t                                 size_type;
+
+ protected:
+    iterator_type   _data;
+    size_type       _slot;
+    size_type       _size;
+
+ public:
+    eytzinger_iter() : _data(), _slot(), _size() {}
+
+    eytzinger_iter(iterator_type data, size_type slot, size_type size)
+            :   _data(data),
+                _slot(slot),
+                _size(size) {}
+
+    eytzinger_iter(const eytzinger_iter& x)
+            :   _data(x.base()),
+                _slot(x.slot()),
+                _size(x.size()) {}
+
+    template <typename U>
+    eytzinger_iter(const eytzinger_iter<U>& x)
+            :   _data(x.base()),
+                _slot(x.slot()),
+                _size(x.size()) {}
+
+    ~eytzinger_iter() {}
+
+    /*                   Assignment operator                    */
+
+    eytzinger_iter& operator=(const eytzinger_iter& rhs) {
+        _data = rhs.base();
+        _slot = rhs.slot();
+        _size = rhs.size();
+        return *this;
+    }
+
+    /*                   Accessors operators                    */
+
+    reference       operator*(void) const { return _data[_slot]; }
+    pointer         operator->(void) const { return &_data[_slot]; }
+    iterator_type   base(void) const { return _data; }
+    size_type       slot(void) const { return _slot; }
+    size_type       size(void) const { return _size; }
+
+    /*                   Increment operators                    */
+
+    eytzinger_iter& operator++(void) {
+        _slot = eytzinger_layout::next(_slot, _size);
+        return *this;
+    }
+    eytzinger_iter  operator++(int) {
+        eytzinger_iter  tmp(*this);
+        _slot = eytzinger_layout::next(_slot, _size);
+        return tmp;
+    }
+
+    /*                   Decrement operators                    */
+
+    eytzinger_iter& operator--(void) {
+        _slot = eytzinger_layout::prev(_slot, _size);
+        return *this;
+    }
+    eytzinger_iter  operator--(int) {
+        eytzinger_iter  tmp(*this);
+        _slot = eytzinger_layout::prev(_slot, _size);
+        return tmp;
+    }
+
+    bool operator==(const eytzinger_iter& rhs) const {
+        return _data == rhs._data && _slot == rhs._slot;
+    }
+
+    bool operator!=(const eytzinger_iter& rhs) const {
+        return !(*this == rhs);
+    }
+};  /* class eytzinger_iter */
+
+}   /* namespace ft */
+
+#endif  /* ITERATORS_EYTZINGER_ITER_HPP_ */
@@ -0,0 +1,90 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef ITERATORS_HASH_ITER_HPP_
+#define ITERATORS_HASH_ITER_HPP_
+
+#include "./iterator_traits.hpp"
+#include "../hash/hash_group.hpp"
+
+namespace ft {
+
+/**
+ * A hash_table position is a slot and its control byte. Stepping forward
+ * skips free slots until a full one or the sentinel byte after the last
+ * slot, which is where end() points.
+ */
+template <typename T>
+class hash_iter {
+    typedef ft::iterator_traits<T>                      _iter_traits;
+
+ public:
+    typedef T                                           iterator_type;
+    typedef std::forward_iterator_tag                   iterator_category;
+    typedef typename _iter_traits::value_type           value_type;
+    typedef typename _iter_traits::difference_type      difference_type;
+    typedef typename _iter_traits::reference            reference;
+    typedef typename _iter_traits::pointer              pointer;
+
+ protected:
+    const hash_ctrl*    _ctrl;
+    iterator_type       _slot;
+
+ public:
+    hash_iter() : _ctrl(), _slot() {}
+
+    hash_iter(const hash_ctrl* ctrl, iterator_type slot)
+            :   _ctrl(ctrl),
+                _slot(slot) {}
+
+    hash_iter(const hash_iter& x) : _ctrl(x.ctrl()), _slot(x.base()) {}
+
+    template <typename U>
+    hash_iter(const hash_iter<U>& x) : _ctrl(x.ctrl()), _slot(x.base()) {}
+
+    ~hash_iter() {}
+
+    /*                   Assignment operator                    */
+
+    hash_iter&      operator=(const hash_iter& rhs) {
+        _ctrl = rhs.ctrl();
+        _slot = rhs.base();
+        return *this;
+    }
+
+    /*                   Accessors operators                    */
+
+    reference           operator*(void) const { return *_slot; }
+    pointer             operator->(void) const { return _slot; }
+    iterator_type       base(void) const { return _slot; }
+    const hash_ctrl*    ctrl(void) const { return _ctrl; }
+
+    /*                   Increment operators                    */
+
+    hash_iter&      operator++(void) {
+        do {
+            ++_ctrl, ++_slot;
+        } while (*_ctrl < hash_ctrl_sentinel);
+        return *this;
+    }
+    hash_iter       operator++(int) {
+        hash_iter   tmp(*this);
+        ++*this;
+        return tmp;
+    }
+};  /* class hash_iter */
+
+/* Mutable and const iterators compare with each other. */
+
+template <typename T, typename U>
+bool    operator==(const hash_iter<T>& x, const hash_iter<U>& y) {
+    return x.ctrl() == y.ctrl();
+}
+
+template <typename T, typename U>
+bool    operator!=(const hash_iter<T>& x, const hash_iter<U>& y) {
+    return x.ctrl() != y.ctrl();
+}
+
+}   /* namespace ft */
+
+#endif  /* ITERATORS_HASH_ITER_HPP_ */
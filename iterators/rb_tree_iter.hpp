@@ -4,10 +4,13 @@
 #define ITERATORS_RB_TREE_ITER_HPP_
 
 #include "./iterator_traits.hpp"
+#include "../rb_tree/tree_node.hpp"
 
 namespace ft {
 
-template <typename T>
+template <typename T,
+          typename Node = ft::node<
+                            typename ft::iterator_traits<T>::value_type> >
 class rb_tree_iter {
     typedef ft::iterator_traits<T>                      _iter_traits;
 
@@ -20,7 +23,7 @@ class rb_tree_iter {
     typedef typename _iter_traits::pointer              pointer;
 
  protected:
-    typedef ft::node<value_type>                        node_base;
+    typedef Node                                        node_base;
     typedef node_base*                                  node_pointer;
     typedef const node_base*                            const_node_pointer;
 
@@ -37,7 +40,7 @@ class rb_tree_iter {
     rb_tree_iter(const rb_tree_iter& x) : _current(x.base()) {}
 
     template <typename U>
-    rb_tree_iter(const rb_tree_iter<U>& x) : _current(x.base()) {}
+    rb_tree_iter(const rb_tree_iter<U, Node>& x) : _current(x.base()) {}
 
     ~rb_tree_iter() {}
 
@@ -53,7 +56,7 @@ class rb_tree_iter {
     reference   operator*(void) const { return _current->data; }
     pointer     operator->(void) const { return &_current->data; }
     node_pointer    base(void) { return _current; }
-    const node_pointer    base(void) const { return _current; }
+    node_pointer    base(void) const { return _current; }
 
     /*                   Increment operators                    */
 
@@ -0,0 +1,195 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef ITERATORS_ZIP_ITER_HPP_
+#define ITERATORS_ZIP_ITER_HPP_
+
+#include "./iterator_traits.hpp"
+#include "../utility/pair.hpp"
+
+namespace ft {
+
+/**
+ * What a zip_iter yields: references to one key and its mapped value,
+ * convertible to the ft::pair they stand for. ft::pair cannot hold
+ * references in C++98, hence this proxy.
+ */
+template <typename Key, typename MappedRef, typename Mapped>
+struct zip_ref {
+    const Key&  first;
+    MappedRef   second;
+
+    zip_ref(const Key& key, MappedRef mapped) : first(key), second(mapped) {}
+
+    operator ft::pair<Key, Mapped>(void) const {
+        return ft::pair<Key, Mapped>(first, second);
+    }
+
+ private:
+    zip_ref&    operator=(const zip_ref&);
+};  /* struct zip_ref */
+
+template <typename K, typename R1, typename R2, typename M>
+bool    operator==(const zip_ref<K, R1, M>& x, const zip_ref<K, R2, M>& y) {
+    return x.first == y.first && x.second == y.second;
+}
+
+template <typename K, typename R1, typename R2, typename M>
+bool    operator!=(const zip_ref<K, R1, M>& x, const zip_ref<K, R2, M>& y) {
+    return !(x == y);
+}
+
+template <typename K, typename R1, typename R2, typename M>
+bool    operator<(const zip_ref<K, R1, M>& x, const zip_ref<K, R2, M>& y) {
+    return x.first < y.first
+        || (!(y.first < x.first) && x.second < y.second);
+}
+
+/**
+ * Walks an array of keys and a parallel array of mapped values as a single
+ * sequence of pairs. Dereferencing yields a zip_ref, so an element's
+ * mapped value can be written through it; operator-> returns a proxy
+ * holding that zip_ref. ft::reverse_iter cannot take the address of
+ * such a temporary: use (*rit).second instead of rit->second.
+ */
+template <typename Key, typename MappedPointer>
+class zip_iter {
+    typedef ft::iterator_traits<MappedPointer>          _mapped_traits;
+
+ public:
+    typedef std::random_access_iterator_tag             iterator_category;
+    typedef ft::pair<Key, typename _mapped_traits::value_type>  value_type;
+    typedef std::ptrdiff_t                              difference_type;
+    typedef ft::zip_ref<Key, typename _mapped_traits::reference,
+                        typename _mapped_traits::value_type>    reference;
+
+    class pointer {
+     public:
+        explicit pointer(const reference& x) : _pair(x) {}
+
+        const reference*    operator->(void) const { return &_pair; }
+
+     private:
+        reference   _pair;
+    };
+
+    zip_iter() : _key(), _mapped() {}
+
+    zip_iter(const Key* key, MappedPointer mapped)
+            :   _key(key),
+                _mapped(mapped) {}
+
+    zip_iter(const zip_iter& x) : _key(x.key_base()), _mapped(x.base()) {}
+
+    template <typename U>
+    zip_iter(const zip_iter<Key, U>& x)
+            :   _key(x.key_base()),
+                _mapped(x.base()) {}
+
+    ~zip_iter() {}
+
+    /*                   Assignment operator                    */
+
+    zip_iter&   operator=(const zip_iter& rhs) {
+        _key = rhs.key_base();
+        _mapped = rhs.base();
+        return *this;
+    }
+
+    /*                   Accessors operators                    */
+
+    reference       operator*(void) const {
+        return reference(*_key, *_mapped);
+    }
+    pointer         operator->(void) const { return pointer(**this); }
+    reference       operator[](difference_type n) const {
+        return reference(_key[n], _mapped[n]);
+    }
+    const Key*      key_base(void) const { return _key; }
+    MappedPointer   base(void) const { return _mapped; }
+
+    /*                   Increment operators                    */
+
+    zip_iter&   operator++(void) { ++_key, ++_mapped; return *this; }
+    zip_iter    operator++(int) {
+        zip_iter    tmp(*this);
+        ++_key, ++_mapped;
+        return tmp;
+    }
+    zip_iter    operator+(difference_type n) const {
+        return zip_iter(_key + n, _mapped + n);
+    }
+    zip_iter&   operator+=(difference_type n) {
+        _key += n, _mapped += n;
+        return *this;
+    }
+
+    /*                   Decrement operators                    */
+
+    zip_iter&   operator--(void) { --_key, --_mapped; return *this; }
+    zip_iter    operator--(int) {
+        zip_iter    tmp(*this);
+        --_key, --_mapped;
+        return tmp;
+    }
+    zip_iter    operator-(difference_type n) const {
+        return zip_iter(_key - n, _mapped - n);
+    }
+    zip_iter&   operator-=(difference_type n) {
+        _key -= n, _mapped -= n;
+        return *this;
+    }
+
+ private:
+    const Key*      _key;
+    MappedPointer   _mapped;
+};  /* class zip_iter */
+
+/*                          Relational Operators                      */
+
+template <typename Key, typename P1, typename P2>
+bool    operator==(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() == y.key_base();
+}
+
+template <typename Key, typename P1, typename P2>
+bool    operator!=(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() != y.key_base();
+}
+
+template <typename Key, typename P1, typename P2>
+bool    operator<(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() < y.key_base();
+}
+
+template <typename Key, typename P1, typename P2>
+bool    operator<=(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() <= y.key_base();
+}
+
+template <typename Key, typename P1, typename P2>
+bool    operator>(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() > y.key_base();
+}
+
+template <typename Key, typename P1, typename P2>
+bool    operator>=(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() >= y.key_base();
+}
+
+/*                          Arithmetic Operators                      */
+
+template <typename Key, typename P1, typename P2>
+typename zip_iter<Key, P1>::difference_type
+        operator-(const zip_iter<Key, P1>& x, const zip_iter<Key, P2>& y) {
+    return x.key_base() - y.key_base();
+}
+
+template <typename Key, typename P>
+zip_iter<Key, P>    operator+(typename zip_iter<Key, P>::difference_type n,
+                              const zip_iter<Key, P>& x) {
+    return x + n;
+}
+
+}   /* namespace ft */
+
+#endif  /* ITERATORS_ZIP_ITER_HPP_ */
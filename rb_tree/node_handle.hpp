@@ -0,0 +1,93 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef RB_TREE_NODE_HANDLE_HPP_
+#define RB_TREE_NODE_HANDLE_HPP_
+
+namespace ft {
+
+/**
+ * Owns a node extracted from a map or set until it is inserted into another
+ * one, or back under a new key, without copying the value or allocating.
+ * Like std::auto_ptr, copying a handle hands the node over to the copy; a
+ * handle still owning a node frees it with the allocator it came from.
+ */
+template <typename Node, typename NodeAllocator,
+          typename Key = typename Node::value_type, typename Mapped = Key>
+class node_handle {
+ public:
+    typedef typename Node::value_type   value_type;
+    typedef Key                         key_type;
+    typedef Mapped                      mapped_type;
+    typedef NodeAllocator               allocator_type;
+    typedef Node*                       node_pointer;
+
+    node_handle() : _node(0), _allocator() {}
+
+    node_handle(node_pointer node, const allocator_type& allocator)
+        :   _node(node),
+            _allocator(allocator) {}
+
+    node_handle(const node_handle& src)
+        :   _node(src._node),
+            _allocator(src._allocator) {
+        src._node = 0;
+    }
+
+    ~node_handle() { _reset(); }
+
+    node_handle&    operator=(const node_handle& rhs) {
+        if (&rhs != this) {
+            _reset();
+            _node = rhs._node;
+            _allocator = rhs._allocator;
+            rhs._node = 0;
+        }
+        return *this;
+    }
+
+    bool            empty(void) const { return !_node; }
+    allocator_type  get_allocator(void) const { return _allocator; }
+
+    value_type&     value(void) const { return _node->data; }
+
+    /* A map element's key can be changed before the node is reinserted. */
+    key_type&       key(void) const {
+        return const_cast<key_type&>(value().first);
+    }
+
+    mapped_type&    mapped(void) const { return value().second; }
+
+    /* Gives up the node without freeing it; the handle is left empty. */
+    node_pointer    release(void) {
+        node_pointer    node = _node;
+
+        _node = 0;
+        return node;
+    }
+
+    void    swap(node_handle& x) {
+        node_pointer    tmp_node(x._node);
+        allocator_type  tmp_allocator(x._allocator);
+
+        x._node = _node;
+        x._allocator = _allocator;
+        _node = tmp_node;
+        _allocator = tmp_allocator;
+    }
+
+ private:
+    mutable node_pointer    _node;
+    allocator_type          _allocator;
+
+    void    _reset(void) {
+        if (_node) {
+            _allocator.destroy(_node);
+            _allocator.deallocate(_node, 1);
+            _node = 0;
+        }
+    }
+};  /* class node_handle */
+
+}   /* namespace ft */
+
+#endif  /* RB_TREE_NODE_HANDLE_HPP_ */
@@ -0,0 +1,132 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef RB_TREE_NODE_UPDATE_HPP_
+#define RB_TREE_NODE_UPDATE_HPP_
+
+#include <cstddef>
+#include <limits>
+
+#include "../utility/functional.hpp"
+#include "../type_traits/type_traits.hpp"
+
+namespace ft {
+
+/**
+ * Node update policies let rb_tree keep a piece of metadata in every node,
+ * computed from the node's value and its children's metadata. The tree
+ * calls the policy on a node whenever its subtree changes shape, children
+ * first; the sentinel keeps a value-initialized metadata_type.
+ */
+
+/* The default: nodes carry nothing and the tree never calls the policy. */
+struct null_node_update {
+    typedef void    metadata_type;
+
+    template <typename Node>
+    void    operator()(Node*) const {}
+};
+
+/**
+ * Keeps the size of each subtree, which gives map and set nth(), rank()
+ * and a logarithmic distance().
+ */
+struct order_statistics_update {
+    typedef std::size_t metadata_type;
+
+    template <typename Node>
+    void    operator()(Node* x) const {
+        x->metadata = x->left->metadata + 1 + x->right->metadata;
+    }
+};
+
+/**
+ * Monoids for aggregate_update: an associative combine operation with its
+ * identity element. The identity of min and max is the extreme value of
+ * T on the other side: infinity where T has one, and never min() for a
+ * floating point T, which is the smallest positive value.
+ */
+
+template <typename T>
+struct sum_monoid {
+    typedef T   value_type;
+
+    T       identity(void) const { return T(); }
+    T       operator()(const T& x, const T& y) const { return x + y; }
+};
+
+template <typename T>
+struct min_monoid {
+    typedef T   value_type;
+
+    T       identity(void) const {
+        typedef std::numeric_limits<T>  limits;
+
+        return limits::has_infinity ? limits::infinity() : limits::max();
+    }
+
+    T       operator()(const T& x, const T& y) const { return y < x ? y : x; }
+};
+
+template <typename T>
+struct max_monoid {
+    typedef T   value_type;
+
+    T       identity(void) const {
+        typedef std::numeric_limits<T>  limits;
+
+        if (limits::is_integer) {
+            return limits::min();
+        }
+        return limits::has_infinity ? -limits::infinity() : -limits::max();
+    }
+
+    T       operator()(const T& x, const T& y) const { return x < y ? y : x; }
+};
+
+/**
+ * Keeps, in each node, the Monoid fold of its subtree's values in order,
+ * which gives map and set aggregate(lo, hi). Extract picks what is folded
+ * out of an element; by default the mapped value of a map, the key of a
+ * set.
+ */
+template <typename Monoid, typename Extract = ft::select_mapped>
+struct aggregate_update {
+    typedef typename Monoid::value_type metadata_type;
+
+    template <typename Node>
+    void    operator()(Node* x) const {
+        x->metadata = combine(combine(of(x->left), value(x->data)),
+                              of(x->right));
+    }
+
+    static metadata_type    identity(void) { return Monoid().identity(); }
+
+    static metadata_type    combine(const metadata_type& x,
+                                    const metadata_type& y) {
+        return Monoid()(x, y);
+    }
+
+    template <typename V>
+    static metadata_type    value(const V& data) { return Extract()(data); }
+
+    /* The fold of a whole subtree; the sentinel folds to the identity. */
+    template <typename Node>
+    static metadata_type    of(const Node* x) {
+        return Node::is_nil(x) ? identity() : x->metadata;
+    }
+};
+
+/**
+ * Whether the metadata of a policy depends on the values in the nodes.
+ * Writing a value in place would leave it stale, so maps then only give
+ * const access to their mapped values, which update() changes instead.
+ */
+template <typename NodeUpdate>
+struct reads_values : public false_type {};
+
+template <typename Monoid, typename Extract>
+struct reads_values<aggregate_update<Monoid, Extract> > : public true_type {};
+
+}   /* namespace ft */
+
+#endif  /* RB_TREE_NODE_UPDATE_HPP_ */
@@ -0,0 +1,279 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef RB_TREE_POOL_ALLOCATOR_HPP_
+#define RB_TREE_POOL_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <new>
+
+namespace ft {
+
+/**
+ * Fixed-size slab pool shared by every copy (and rebound copy) of a
+ * pool_allocator. Memory is carved out of chunks that grow geometrically,
+ * freed slots are kept on an intrusive free list, and the whole pool can
+ * be handed back at once through release(). It is not synchronized.
+ */
+class node_pool {
+ public:
+    explicit node_pool(bool process_wide = false)
+        :   _process_wide(process_wide),
+            _references(1),
+            _slot_size(0),
+            _chunks(0),
+            _free_list(0),
+            _bump(0),
+            _bump_end(0),
+            _next_chunk_slots(first_chunk_slots) {}
+
+    ~node_pool() { release(); }
+
+    void    retain(void) { ++_references; }
+    bool    drop(void) { return --_references == 0; }
+    bool    is_shared(void) const { return _references > 1; }
+    bool    is_process_wide(void) const { return _process_wide; }
+
+    /* Every pool serves a single slot size, fixed by its first user. */
+    bool    serves(std::size_t slot_size) {
+        if (!_slot_size) {
+            _slot_size = slot_size;
+        }
+        return _slot_size == slot_size;
+    }
+
+    void*   allocate(void) {
+        if (_free_list) {
+            free_slot*  slot = _free_list;
+            _free_list = slot->next;
+            return slot;
+        }
+        if (_bump == _bump_end) {
+            _grow();
+        }
+        void*   slot = _bump;
+        _bump += _slot_size;
+        return slot;
+    }
+
+    void    deallocate(void* p) {
+        free_slot*  slot = static_cast<free_slot*>(p);
+        slot->next = _free_list;
+        _free_list = slot;
+    }
+
+    void    release(void) {
+        while (_chunks) {
+            chunk*  next = _chunks->next;
+            ::operator delete(_chunks);
+            _chunks = next;
+        }
+        _free_list = 0;
+        _bump = _bump_end = 0;
+        _next_chunk_slots = first_chunk_slots;
+    }
+
+ private:
+    struct free_slot { free_slot* next; };
+
+    union chunk {
+        chunk*      next;
+        long double align_long_double;
+        void*       align_pointer;
+    };
+
+    static const std::size_t    first_chunk_slots = 16;
+    static const std::size_t    max_chunk_slots = 4096;
+
+    bool            _process_wide;
+    std::size_t     _references;
+    std::size_t     _slot_size;
+    chunk*          _chunks;
+    free_slot*      _free_list;
+    char*           _bump;
+    char*           _bump_end;
+    std::size_t     _next_chunk_slots;
+
+    node_pool(const node_pool&);
+    node_pool&  operator=(const node_pool&);
+
+    void    _grow(void) {
+        std::size_t bytes = _next_chunk_slots * _slot_size;
+        chunk*      new_chunk = static_cast<chunk*>(
+                                ::operator new(sizeof(chunk) + bytes));
+
+        new_chunk->next = _chunks;
+        _chunks = new_chunk;
+        _bump = reinterpret_cast<char*>(new_chunk + 1);
+        _bump_end = _bump + bytes;
+        if (_next_chunk_slots < max_chunk_slots) {
+            _next_chunk_slots <<= 1;
+        }
+    }
+};  /* class node_pool */
+
+/* Tag asking pool_allocator for the process-wide pool of its type. */
+struct shared_pool_t {};
+const shared_pool_t shared_pool = shared_pool_t();
+
+/**
+ * Allocator that serves single-object requests from a node_pool, meant for
+ * node based containers (ft::map and ft::set use it by default). Requests
+ * for more than one object, or for a type whose slot size differs from the
+ * pool's, go straight to operator new.
+ *
+ * A default-constructed allocator, and its copies, draw from a pool
+ * nobody else uses, which a container can hand back in one step when it
+ * is cleared. Allocators constructed with shared_pool all use one pool
+ * per type, kept until the program exits, so they compare equal and
+ * containers built with them move nodes between each other without
+ * copies. That pool is not synchronized: only share it between containers
+ * used from the same thread.
+ */
+template <typename T>
+class pool_allocator {
+ public:
+    typedef T                   value_type;
+    typedef T*                  pointer;
+    typedef const T*            const_pointer;
+    typedef T&                  reference;
+    typedef const T&            const_reference;
+    typedef std::size_t         size_type;
+    typedef std::ptrdiff_t      difference_type;
+
+    template <typename U>
+    struct rebind { typedef pool_allocator<U> other; };
+
+    pool_allocator() : _pool(new node_pool()) {}
+
+    explicit pool_allocator(shared_pool_t) : _pool(process_pool()) {
+        _pool->retain();
+    }
+
+    pool_allocator(const pool_allocator& src) : _pool(src._pool) {
+        _pool->retain();
+    }
+
+    /* A rebound shared allocator uses the shared pool of its own type. */
+    template <typename U>
+    pool_allocator(const pool_allocator<U>& src)
+        :   _pool(src.uses_shared_pool() ? process_pool() : src.pool()) {
+        _pool->retain();
+    }
+
+    ~pool_allocator() { _drop(); }
+
+    pool_allocator& operator=(const pool_allocator& rhs) {
+        rhs._pool->retain();
+        _drop();
+        _pool = rhs._pool;
+        return *this;
+    }
+
+    pointer         address(reference x) const { return &x; }
+    const_pointer   address(const_reference x) const { return &x; }
+
+    pointer allocate(size_type n, const void* = 0) {
+        if (n == 1 && _pool->serves(_slot_size())) {
+            return static_cast<pointer>(_pool->allocate());
+        }
+        if (n > max_size()) {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(::operator new(n * sizeof(T)));
+    }
+
+    void    deallocate(pointer p, size_type n) {
+        if (n == 1 && _pool->serves(_slot_size())) {
+            _pool->deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    size_type   max_size(void) const {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    void    construct(pointer p, const_reference val) { new(p) T(val); }
+    void    destroy(pointer p) { p->~T(); }
+
+    /**
+     * Hands every chunk back at once. Only legal when no other allocator
+     * shares the pool and every object it served has been destroyed.
+     */
+    void    release(void) { _pool->release(); }
+    bool    owns_pool(void) const { return !_pool->is_shared(); }
+
+    node_pool*  pool(void) const { return _pool; }
+    bool        uses_shared_pool(void) const {
+        return _pool->is_process_wide();
+    }
+
+    /**
+     * The pool behind shared_pool allocators. It holds a reference to
+     * itself, so it is never deleted, not even by static destructors.
+     */
+    static node_pool*   process_pool(void) {
+        static node_pool* const pool = new node_pool(true);
+
+        return pool;
+    }
+
+ private:
+    node_pool*  _pool;
+
+    struct _alignment_probe { char c; T t; };
+
+    static size_type    _slot_size(void) {
+        size_type   align = sizeof(_alignment_probe) - sizeof(T);
+        size_type   size = sizeof(T);
+
+        if (size < sizeof(void*)) {
+            size = sizeof(void*);
+        }
+        if (align < sizeof(void*)) {
+            align = sizeof(void*);
+        }
+        return (size + align - 1) / align * align;
+    }
+
+    void    _drop(void) {
+        if (_pool->drop()) {
+            delete _pool;
+        }
+    }
+};  /* class pool_allocator */
+
+template <typename T, typename U>
+bool    operator==(const pool_allocator<T>& x, const pool_allocator<U>& y) {
+    return x.pool() == y.pool()
+        || (x.uses_shared_pool() && y.uses_shared_pool());
+}
+
+template <typename T, typename U>
+bool    operator!=(const pool_allocator<T>& x, const pool_allocator<U>& y) {
+    return !(x == y);
+}
+
+/**
+ * Lets node based containers hand every node back in a single step when
+ * their allocator supports it. Allocators that do not are left alone and
+ * get one deallocate call per node.
+ */
+template <typename Alloc>
+struct allocator_release {
+    static bool can_release(const Alloc&) { return false; }
+    static void release(Alloc&) {}
+};
+
+template <typename T>
+struct allocator_release<pool_allocator<T> > {
+    static bool can_release(const pool_allocator<T>& alloc) {
+        return alloc.owns_pool();
+    }
+    static void release(pool_allocator<T>& alloc) { alloc.release(); }
+};
+
+}   /* namespace ft */
+
+#endif  /* RB_TREE_POOL_ALLOCATOR_HPP_ */
@@ -5,23 +5,41 @@
 
 #include <memory>
 
+#include "../type_traits/type_traits.hpp"
+#include "../utility/pair.hpp"
 #include "./tree_node.hpp"
+#include "./pool_allocator.hpp"
+#include "./node_update.hpp"
 #include "../iterators/reverse_iter.hpp"
 #include "../iterators/rb_tree_iter.hpp"
 
 namespace ft {
 
-template <typename value_type,
+/**
+ * Red-black tree behind ft::map and ft::set. Elements are ordered by the
+ * key KeyOfValue extracts from them, so lookups only need a key. NodeUpdate
+ * optionally keeps extra metadata in every node (see node_update.hpp).
+ */
+template <typename key_type,
+          typename value_type,
+          typename KeyOfValue,
           typename Compare,
-          typename AllocTp = std::allocator<value_type> >
+          typename AllocTp = std::allocator<value_type>,
+          typename NodeUpdate = ft::null_node_update>
 class rb_tree {
-    typedef node<value_type>                            node_base;
+ public:
+    typedef node<value_type,
+                 typename NodeUpdate::metadata_type>    node_base;
     typedef node_base*                                  node_pointer;
     typedef const node_base*                            const_node_pointer;
-    typedef node_base**                                 node_pointer_addr;
+
     typedef typename AllocTp::template
                     rebind<node_base>::other            node_allocator;
 
+ private:
+    typedef std::allocator<node_base>                   header_allocator;
+    typedef ft::allocator_release<node_allocator>       node_release;
+
  public:
     typedef size_t                                      size_type;
     typedef ptrdiff_t                                   difference_type;
@@ -31,8 +49,8 @@ class rb_tree {
     typedef const value_type*                           const_pointer;
     typedef Compare                                     key_compare;
 
-    typedef ft::rb_tree_iter<pointer>                   iterator;
-    typedef ft::rb_tree_iter<const_pointer>             const_iterator;
+    typedef ft::rb_tree_iter<pointer, node_base>        iterator;
+    typedef ft::rb_tree_iter<const_pointer, node_base>  const_iterator;
     typedef ft::reverse_iter<iterator>                  reverse_iterator;
     typedef ft::reverse_iter<const_iterator>            const_reverse_iterator;
 
@@ -40,36 +58,72 @@ class rb_tree {
                     const AllocTp& allocator = AllocTp())
             :   _size(0),
                 _comp(comp),
-                _node_allocator(allocator) {
-        _nil = _node_allocator.allocate(1);
-        _node_allocator.construct(_nil, node_base());
-        _nil->leaf = _nil;
-        _nil->left = _nil;
-        _nil->right = _nil;
-        _root = _nil;
+                _node_allocator(allocator),
+                _nil(node_base::leaf()) {
+        _create_header();
+    }
+
+    /* Copies share src's allocator; assignment keeps this tree's own. */
+    rb_tree(const rb_tree& src)
+            :   _size(0),
+                _comp(src._comp),
+                _node_allocator(src._node_allocator),
+                _nil(node_base::leaf()) {
+        _create_header();
+        *this = src;
     }
 
     ~rb_tree() {
         clear();
-        _node_allocator.destroy(_nil);
-        _node_allocator.deallocate(_nil, 1);
+        _header_allocator.destroy(_header);
+        _header_allocator.deallocate(_header, 1);
+    }
+
+    /**
+     * Structural copy: clones the shape and colors of src in O(n) without
+     * a single comparison. Nodes already owned by this tree are recycled
+     * for the copy before any new one is allocated.
+     */
+    rb_tree&    operator=(const rb_tree& src) {
+        if (&src == this) {
+            return *this;
+        }
+        node_pointer    reusable = _detach_nodes();
+
+        _comp = src._comp;
+        try {
+            if (src._root != src._nil) {
+                _root = _copy_subtree(src._root, _header, reusable);
+                _leftmost = node_base::minimum(_root);
+                _header->set_parent(node_base::maximum(_root));
+                _size = src._size;
+            }
+        } catch (...) {
+            _free_node_list(reusable);
+            throw;
+        }
+        _free_node_list(reusable);
+        return *this;
     }
 
     void swap(rb_tree& src) {
-        node_pointer        tmp_nil(src._nil);
+        node_pointer        tmp_header(src._header);
         node_pointer        tmp_root(src._root);
+        node_pointer        tmp_leftmost(src._leftmost);
         size_type           tmp_size(src._size);
-        compare_functions   tmp_comp(src._comp);
+        key_compare         tmp_comp(src._comp);
         node_allocator      tmp_node_allocator(src._node_allocator);
 
-        src._nil = _nil;
+        src._header = _header;
         src._root = _root;
+        src._leftmost = _leftmost;
         src._size = _size;
         src._comp = _comp;
         src._node_allocator = _node_allocator;
 
-        _nil = tmp_nil;
+        _header = tmp_header;
         _root = tmp_root;
+        _leftmost = tmp_leftmost;
         _size = tmp_size;
         _comp = tmp_comp;
         _node_allocator = tmp_node_allocator;
@@ -83,290 +137,1477 @@ class rb_tree {
         return _node_allocator.max_size();
     }
 
+    node_allocator  get_allocator(void) const {
+        return _node_allocator;
+    }
+
     iterator    begin(void) {
-        return iterator(node_base::minimum(_root));
+        return iterator(_leftmost);
     }
 
     iterator    end(void) {
-        return iterator(_nil);
+        return iterator(_header);
     }
 
     const_iterator    begin(void) const {
-        return const_iterator(node_base::minimum(_root));
+        return const_iterator(_leftmost);
     }
 
     const_iterator    end(void) const {
-        return const_iterator(_nil);
+        return const_iterator(_header);
     }
 
+    /**
+     * Iterative teardown. With a releasable allocator the memory goes back
+     * in one step, and trivially destructible values are not even visited.
+     */
     void clear(void) {
-        _clear_recursive(_root);
-        _size = 0;
+        if (node_release::can_release(_node_allocator)) {
+            if (!ft::is_trivially_destructible<value_type>::value) {
+                _destroy_values(_flatten(_root));
+            }
+            node_release::release(_node_allocator);
+        } else {
+            _free_node_list(_flatten(_root));
+        }
+        _set_empty();
     }
 
-    node_pointer    lower_bound(const_reference to_compare) {
-        return _find_bound(to_compare, _comp.not_less);
-    }
+    /**
+     * Lookups take a key, or with a transparent comparator anything it can
+     * compare against one; no value_type is ever built to probe the tree.
+     */
+    template <typename K>
+    node_pointer    lower_bound(const K& key) const {
+        node_pointer    x = _root;
+        node_pointer    bound = _header;
 
-    node_pointer    upper_bound(const_reference to_compare) {
-        return _find_bound(to_compare, _comp.greater);
+        while (x != _nil) {
+            if (!_comp(_key(x), key)) {
+                bound = x;
+                x = x->left;
+            } else {
+                x = x->right;
+            }
+        }
+        return bound;
     }
 
-    const_node_pointer    search(const_reference data) const {
-        const_node_pointer    node = _root;
+    template <typename K>
+    node_pointer    upper_bound(const K& key) const {
+        node_pointer    x = _root;
+        node_pointer    bound = _header;
 
-        while (node != _nil) {
-            if (_comp.less(data, node->data)) {
-                node = node->left;
-            } else if (_comp.greater(data, node->data)) {
-                node = node->right;
+        while (x != _nil) {
+            if (_comp(key, _key(x))) {
+                bound = x;
+                x = x->left;
             } else {
-                return node;
+                x = x->right;
             }
         }
-        return 0;
+        return bound;
     }
 
-    node_pointer    search(const_reference data) {
-        node_pointer    node = _root;
+    template <typename K>
+    const_node_pointer    search(const K& key) const {
+        return _search(key);
+    }
 
-        while (node != _nil) {
-            if (_comp.less(data, node->data)) {
-                node = node->left;
-            } else if (_comp.greater(data, node->data)) {
-                node = node->right;
-            } else {
-                return node;
+    template <typename K>
+    node_pointer    search(const K& key) {
+        return _search(key);
+    }
+
+    /**
+     * Inserts data unless an equivalent element is already in the tree.
+     * A single descent with one comparison per level finds the insertion
+     * point; the last node we stepped right from is the only possible
+     * duplicate, so one extra comparison settles it.
+     */
+    ft::pair<iterator, bool>    insert_unique(const_reference data) {
+        node_pointer    parent;
+        bool            go_left;
+        node_pointer    duplicate = _unique_position(KeyOfValue()(data),
+                                                     parent, go_left);
+
+        if (duplicate) {
+            return ft::make_pair(iterator(duplicate), false);
+        }
+        return ft::make_pair(_insert_at(parent, go_left, data), true);
+    }
+
+    /**
+     * Hinted insert_unique. When data belongs right before hint, it is
+     * linked as a child of hint or of its predecessor, whichever has the
+     * free slot, after comparing against those two nodes only; appending
+     * at end() is O(1) plus rebalancing. A wrong hint costs a normal
+     * insert_unique.
+     */
+    iterator    insert_unique(node_pointer hint, const_reference data) {
+        node_pointer    parent;
+        bool            go_left;
+        node_pointer    duplicate = _hint_unique_position(
+                            hint, KeyOfValue()(data), parent, go_left);
+
+        if (duplicate) {
+            return iterator(duplicate);
+        }
+        return _insert_at(parent, go_left, data);
+    }
+
+    /**
+     * insert_unique for the node a handle owns, which is emptied only if
+     * the node was linked. A node from an allocator that does not compare
+     * equal to this tree's cannot be adopted: its value is copied into a
+     * new node instead, and the handle frees the old one.
+     */
+    template <typename Handle>
+    ft::pair<iterator, bool>    reinsert_unique(Handle& handle) {
+        node_pointer    parent;
+        bool            go_left;
+
+        if (handle.empty()) {
+            return ft::make_pair(end(), false);
+        }
+        node_pointer    duplicate = _unique_position(
+                            KeyOfValue()(handle.value()), parent, go_left);
+
+        if (duplicate) {
+            return ft::make_pair(iterator(duplicate), false);
+        }
+        return ft::make_pair(_adopt(parent, go_left, handle), true);
+    }
+
+    template <typename Handle>
+    iterator    reinsert_unique(node_pointer hint, Handle& handle) {
+        node_pointer    parent;
+        bool            go_left;
+
+        if (handle.empty()) {
+            return end();
+        }
+        const key_type& key = KeyOfValue()(handle.value());
+        node_pointer    duplicate = _hint_unique_position(hint, key, parent,
+                                                          go_left);
+
+        if (duplicate) {
+            return iterator(duplicate);
+        }
+        return _adopt(parent, go_left, handle);
+    }
+
+    /**
+     * Inserts [first, last) skipping duplicates. Into an empty tree, the
+     * leading run of sorted elements is turned into nodes in one pass and
+     * linked into a balanced tree in O(n); whatever follows the first
+     * out-of-order element is inserted one at a time.
+     */
+    template <typename InputIt>
+    void    insert_range(InputIt first, InputIt last) {
+        if (!_size) {
+            first = _build_sorted_prefix(first, last, true);
+        }
+        while (first != last) {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    /**
+     * Inserts data even if equivalent elements are already in the tree;
+     * it goes after all of them, so equal keys keep insertion order.
+     */
+    iterator    insert_equal(const_reference data) {
+        const key_type& key = KeyOfValue()(data);
+        node_pointer    parent = 0;
+        node_pointer    x = _root;
+        bool            go_left = true;
+
+        while (x != _nil) {
+            parent = x;
+            go_left = _comp(key, _key(x));
+            x = go_left ? x->left : x->right;
+        }
+        return _insert_at(parent, go_left, data);
+    }
+
+    /**
+     * Hinted insert_equal: data goes as close as possible before hint.
+     * When it fits right before or right after hint it is linked there,
+     * next to hint or one of its neighbours, in O(1) plus rebalancing.
+     */
+    iterator    insert_equal(node_pointer hint, const_reference data) {
+        const key_type& key = KeyOfValue()(data);
+
+        if (hint == _header) {
+            if (!_size) {
+                return _insert_at(0, false, data);
+            }
+            if (!_comp(key, _key(_header->parent()))) {
+                return _insert_at(_header->parent(), false, data);
             }
+            return insert_equal(data);
+        }
+        if (!_comp(_key(hint), key)) {
+            if (hint == _leftmost) {
+                return _insert_at(hint, true, data);
+            }
+            node_pointer    before = node_base::predecessor(hint);
+
+            if (_comp(key, _key(before))) {
+                return insert_equal(data);
+            }
+            if (before->right == _nil) {
+                return _insert_at(before, false, data);
+            }
+            return _insert_at(hint, true, data);
+        }
+        node_pointer    after = node_base::successor(hint);
+
+        if (after != _header && _comp(_key(after), key)) {
+            return _insert_equal_lower(data);
+        }
+        if (hint->right == _nil) {
+            return _insert_at(hint, false, data);
+        }
+        return _insert_at(after, true, data);
+    }
+
+    template <typename InputIt>
+    void    insert_equal_range(InputIt first, InputIt last) {
+        if (!_size) {
+            first = _build_sorted_prefix(first, last, false);
+        }
+        while (first != last) {
+            insert_equal(*first);
+            ++first;
         }
-        return 0;
     }
 
-    iterator    insert(const_reference data, node_pointer hint = 0) {
-        node_pointer        parent = 0;
-        node_pointer_addr   root_addr = _is_nil(hint) ? &_root : &hint;
+    /**
+     * Bounds of the elements equivalent to key. One descent finds the
+     * first of them; the two bounds are then searched for only below it.
+     */
+    template <typename K>
+    ft::pair<node_pointer, node_pointer>    equal_range(const K& key) const {
+        node_pointer    x = _root;
+        node_pointer    upper = _header;
 
-        while (*root_addr != _nil) {
-            parent = *root_addr;
-            if (_comp.less((*root_addr)->data, data)) {
-                root_addr = &(*root_addr)->right;
-            } else if (_comp.greater((*root_addr)->data, data)) {
-                root_addr = &(*root_addr)->left;
+        while (x != _nil) {
+            if (_comp(_key(x), key)) {
+                x = x->right;
+            } else if (_comp(key, _key(x))) {
+                upper = x;
+                x = x->left;
             } else {
-                return iterator(*root_addr);
+                node_pointer    lower = x;
+
+                for (node_pointer y = x->left; y != _nil;) {
+                    if (_comp(_key(y), key)) {
+                        y = y->right;
+                    } else {
+                        lower = y;
+                        y = y->left;
+                    }
+                }
+                for (node_pointer y = x->right; y != _nil;) {
+                    if (_comp(key, _key(y))) {
+                        upper = y;
+                        y = y->left;
+                    } else {
+                        y = y->right;
+                    }
+                }
+                return ft::make_pair(lower, upper);
             }
         }
-        *root_addr = _create_new_node(data, parent);
-        _balance_tree_insert(*root_addr);
-        _update_nil_insert(*root_addr);
-        ++_size;
-        return iterator(*root_addr);
+        return ft::make_pair(upper, upper);
     }
 
-    bool    remove(const_reference data) {
-        node_pointer    node = search(data);
+    /* Number of elements equivalent to key, in O(log n + count). */
+    template <typename K>
+    size_type   count(const K& key) const {
+        ft::pair<node_pointer, node_pointer>    range = equal_range(key);
+        size_type                               n = 0;
+
+        for (; range.first != range.second; ++n) {
+            range.first = node_base::successor(range.first);
+        }
+        return n;
+    }
+
+    /* Erases every element equivalent to key and returns how many. */
+    template <typename K>
+    size_type   remove_equal(const K& key) {
+        ft::pair<node_pointer, node_pointer>    range = equal_range(key);
+        size_type                               old_size = _size;
+
+        erase(range.first, range.second);
+        return old_size - _size;
+    }
+
+    template <typename K>
+    bool    remove(const K& key) {
+        node_pointer    node = _search(key);
         if (!node) {
             return false;
         }
+        erase(node);
+        return true;
+    }
+
+    /* Unlinks the node the caller already holds, with no search. */
+    void    erase(node_pointer node) {
+        _unlink(node);
+        _destroy_node(node);
+    }
+
+    /* Recomputes the metadata above node after its value changed in place. */
+    void    refresh(node_pointer node) {
+        _update_path(node);
+    }
+
+    /* Unlinks node without destroying it, for a node handle to own. */
+    node_pointer    extract(node_pointer node) {
+        _unlink(node);
+        return node;
+    }
+
+    /**
+     * Erases [first, last). Erasing everything is a clear(). When most of
+     * the tree goes away, the survivors are relinked into a fresh balanced
+     * tree in one pass instead of unlinking the range node by node.
+     */
+    void    erase(node_pointer first, node_pointer last) {
+        if (first == _leftmost && last == _header) {
+            clear();
+            return;
+        }
+        size_type   count = 0;
+
+        for (node_pointer x = first; x != last && count <= _size / 2;
+             x = node_base::successor(x)) {
+            ++count;
+        }
+        if (count <= _size / 2) {
+            while (first != last) {
+                node_pointer    next = node_base::successor(first);
+
+                erase(first);
+                first = next;
+            }
+        } else {
+            _erase_by_rebuild(first, last);
+        }
+    }
+
+    /**
+     * Moves every element not ordered before key into dest, which must be
+     * empty and share this tree's allocator. The tree is cut along the path
+     * to key and the pieces on each side are joined back by black height:
+     * no node is copied or allocated, and relinking is O(log n). Only the
+     * number of elements moved still has to be counted, in O(log n) with
+     * order_statistics_update, otherwise by walking from the cut to the
+     * nearer end: O(min(k, n - k)) for k elements moved, which bounds the
+     * whole split without subtree sizes.
+     */
+    template <typename K>
+    void    split(const K& key, rb_tree& dest) {
+        node_pointer    cut = lower_bound(key);
+
+        if (cut == _header) {
+            return;
+        }
+        size_type   moved = _count_from(cut, ft::is_same<NodeUpdate,
+                                        ft::order_statistics_update>());
+        size_type   kept = _size - moved;
+        subtree     tree = { _root, _black_height(_root) };
+        subtree     left;
+        subtree     right;
+
+        _split(tree, key, left, right);
+        _set_root(left.root, kept);
+        dest._set_root(right.root, moved);
+    }
+
+    /**
+     * Moves every element of right, none of which may be ordered before an
+     * element of this tree, to the end of this tree. The first element of
+     * right joins both trees below it in O(log n), without any copy or
+     * allocation; right must share this tree's allocator.
+     */
+    void    join(rb_tree& right) {
+        if (!right._size) {
+            return;
+        }
+        node_pointer    mid = right._leftmost;
+        size_type       n = _size + right._size;
+
+        right._unlink(mid);
+        subtree     left_tree = { _root, _black_height(_root) };
+        subtree     right_tree = { right._root,
+                                   right._black_height(right._root) };
+
+        right._set_empty();
+        _set_root(_join(left_tree, mid, right_tree).root, n);
+    }
+
+    /**
+     * Moves the elements of src whose keys are not in this tree yet. When
+     * all of src is ordered after or before this tree, the two are joined
+     * in O(log n); otherwise each node is unlinked from src and relinked
+     * here. Nodes only move between trees with equal allocators, elements
+     * are copied across any others.
+     */
+    void    merge_unique(rb_tree& src) {
+        if (&src == this || !src._size) {
+            return;
+        }
+        if (_node_allocator != src._node_allocator) {
+            _merge_by_copy(src);
+        } else if (!_size
+                || _comp(_key(_header->parent()), _key(src._leftmost))) {
+            join(src);
+        } else if (_comp(_key(src._header->parent()), _key(_leftmost))) {
+            src.join(*this);
+            _set_root(src._root, src._size);
+            src._set_empty();
+        } else {
+            _merge_by_relink(src);
+        }
+    }
+
+    /**
+     * Set algebra with another tree, in place, keeping this tree's element
+     * on equal keys. Each node of one tree splits the other at its key, the
+     * two sides are combined recursively and joined back under it, so no
+     * key is searched for twice: O(m log(n / m + 1)) for sizes m <= n, plus
+     * one step per element added or destroyed. other is only read; the
+     * union first copies it, so a throwing copy leaves this tree as it was.
+     */
+    void    unite_unique(const rb_tree& other) {
+        if (&other == this || !other._size) {
+            return;
+        }
+        node_pointer    none = 0;
+        node_pointer    copy = _copy_subtree(other._root, _header, none);
+        subtree         mine = { _root, _black_height(_root) };
+        subtree         theirs = { copy, _black_height(copy) };
+        size_type       n = _size + other._size;
+        size_type       dropped = 0;
+
+        mine = _unite(mine, theirs, dropped);
+        _set_root(mine.root, n - dropped);
+    }
+
+    void    intersect(const rb_tree& other) {
+        if (&other == this) {
+            return;
+        }
+        subtree     mine = { _root, _black_height(_root) };
+        size_type   n = _size;
+        size_type   dropped = 0;
+
+        mine = _intersect(mine, other._root, dropped);
+        _set_root(mine.root, n - dropped);
+    }
+
+    void    subtract(const rb_tree& other) {
+        if (&other == this) {
+            clear();
+            return;
+        }
+        subtree     mine = { _root, _black_height(_root) };
+        size_type   n = _size;
+        size_type   dropped = 0;
+
+        mine = _subtract(mine, other._root, dropped);
+        _set_root(mine.root, n - dropped);
+    }
+
+    /**
+     * Order statistics, only usable with order_statistics_update. select()
+     * returns the k-th smallest node, or the header past the last one;
+     * rank() counts the elements ordered before key; position() is the
+     * index of a node, size() for the header. All are O(log n).
+     */
+    node_pointer    select(size_type k) const {
+        node_pointer    x = _root;
+
+        while (x != _nil) {
+            size_type   left_size = x->left->metadata;
+
+            if (k < left_size) {
+                x = x->left;
+            } else if (k == left_size) {
+                return x;
+            } else {
+                k -= left_size + 1;
+                x = x->right;
+            }
+        }
+        return _header;
+    }
+
+    template <typename K>
+    size_type   rank(const K& key) const {
+        node_pointer    x = _root;
+        size_type       before = 0;
+
+        while (x != _nil) {
+            if (_comp(_key(x), key)) {
+                before += x->left->metadata + 1;
+                x = x->right;
+            } else {
+                x = x->left;
+            }
+        }
+        return before;
+    }
+
+    size_type   position(const_node_pointer x) const {
+        if (x == _header) {
+            return _size;
+        }
+        size_type   before = x->left->metadata;
+
+        for (const_node_pointer p = x->parent(); p != _header;
+             x = p, p = p->parent()) {
+            if (x == p->right) {
+                before += p->left->metadata + 1;
+            }
+        }
+        return before;
+    }
+
+    /**
+     * Folds the elements with keys in [lo, hi), only usable with
+     * aggregate_update. Below the node where the paths to lo and hi split,
+     * each step towards lo takes in a whole right subtree and each step
+     * towards hi a whole left one, so this is O(log n).
+     */
+    template <typename K>
+    typename NodeUpdate::metadata_type  aggregate(const K& lo,
+                                                  const K& hi) const {
+        typedef typename NodeUpdate::metadata_type  metadata_type;
+        node_pointer    x = _root;
+
+        while (x != _nil) {
+            if (_comp(_key(x), lo)) {
+                x = x->right;
+            } else if (!_comp(_key(x), hi)) {
+                x = x->left;
+            } else {
+                break;
+            }
+        }
+        if (x == _nil) {
+            return NodeUpdate::identity();
+        }
+        metadata_type   below_lo = NodeUpdate::identity();
+        metadata_type   below_hi = NodeUpdate::identity();
+
+        for (node_pointer y = x->left; y != _nil;) {
+            if (_comp(_key(y), lo)) {
+                y = y->right;
+            } else {
+                below_lo = NodeUpdate::combine(NodeUpdate::combine(
+                                NodeUpdate::value(y->data),
+                                NodeUpdate::of(y->right)), below_lo);
+                y = y->left;
+            }
+        }
+        for (node_pointer y = x->right; y != _nil;) {
+            if (!_comp(_key(y), hi)) {
+                y = y->left;
+            } else {
+                below_hi = NodeUpdate::combine(below_hi, NodeUpdate::combine(
+                                NodeUpdate::of(y->left),
+                                NodeUpdate::value(y->data)));
+                y = y->right;
+            }
+        }
+        return NodeUpdate::combine(NodeUpdate::combine(below_lo,
+                                   NodeUpdate::value(x->data)), below_hi);
+    }
+
+ private:
+    static const bool   _augmented = !ft::is_same<
+                            typename NodeUpdate::metadata_type, void>::value;
+
+    /* A detached subtree, with the black height split and join work on. */
+    struct subtree {
+        node_pointer    root;
+        size_type       height;
+    };
+
+    size_type           _size;
+    key_compare         _comp;
+    node_allocator      _node_allocator;
+    header_allocator    _header_allocator;
+    node_pointer        _root;
+    node_pointer        _leftmost;
+    node_pointer        _header;
+    node_pointer        _nil;
+
+    static const key_type&  _key(const_node_pointer x) {
+        return KeyOfValue()(x->data);
+    }
+
+    node_pointer _create_new_node(const_reference data) {
+        node_pointer        node = _node_allocator.allocate(1);
+
+        _node_allocator.construct(node, node_base(data, 0, _nil, red));
+        return node;
+    }
+
+    /**
+     * The header is this tree's end() node and the parent of its root. Its
+     * children point back to itself, which stops successor() climbing past
+     * the maximum; its own parent is the rightmost node.
+     */
+    void    _create_header(void) {
+        _header = _header_allocator.allocate(1);
+        _header_allocator.construct(_header, node_base());
+        _header->left = _header;
+        _header->right = _header;
+        _set_empty();
+    }
+
+    void    _set_empty(void) {
+        _root = _nil;
+        _leftmost = _header;
+        _header->set_parent(_header);
+        _size = 0;
+    }
+
+    /* Makes the valid subtree root, holding n elements, the whole tree. */
+    void    _set_root(node_pointer root, size_type n) {
+        if (root == _nil) {
+            _set_empty();
+            return;
+        }
+        _root = root;
+        _root->set_parent(_header);
+        _root->set_color(black);
+        _leftmost = node_base::minimum(_root);
+        _header->set_parent(node_base::maximum(_root));
+        _size = n;
+    }
+
+    /**
+     * Empties the tree without destroying anything and returns its nodes
+     * chained through their right pointers.
+     */
+    node_pointer    _detach_nodes(void) {
+        node_pointer    head = _flatten(_root);
+
+        _set_empty();
+        return head;
+    }
+
+    /**
+     * Turns the subtree into an in-order list chained through the right
+     * pointers and ended by a null one. Right rotations flatten each left
+     * spine as it is met, so the walk is O(n) and needs no stack.
+     */
+    node_pointer    _flatten(node_pointer x) {
+        node_pointer    head = 0;
+        node_pointer    tail = 0;
+
+        while (x != _nil) {
+            if (x->left != _nil) {
+                node_pointer    left = x->left;
+
+                x->left = left->right;
+                left->right = x;
+                x = left;
+            } else {
+                if (tail) {
+                    tail->right = x;
+                } else {
+                    head = x;
+                }
+                tail = x;
+                x = x->right;
+            }
+        }
+        if (tail) {
+            tail->right = 0;
+        }
+        return head;
+    }
+
+    void    _destroy_values(node_pointer list) {
+        while (list) {
+            node_pointer    next = list->right;
+
+            _node_allocator.destroy(list);
+            list = next;
+        }
+    }
+
+    void    _free_node_list(node_pointer list) {
+        while (list) {
+            node_pointer    next = list->right;
+
+            _destroy_node(list);
+            list = next;
+        }
+    }
+
+    /**
+     * Copies the value, color and metadata of src into a recycled node when
+     * there is any left, or into a new one.
+     */
+    node_pointer    _clone_node(const_node_pointer src, node_pointer parent,
+                                node_pointer& reusable) {
+        node_pointer    node;
+
+        if (reusable) {
+            node = reusable;
+            reusable = reusable->right;
+            _node_allocator.destroy(node);
+        } else {
+            node = _node_allocator.allocate(1);
+        }
+        try {
+            _node_allocator.construct(node, *src);
+        } catch (...) {
+            _node_allocator.deallocate(node, 1);
+            throw;
+        }
+        node->left = _nil;
+        node->right = _nil;
+        node->set_parent(parent);
+        return node;
+    }
+
+    /* Recurses on right children and loops down left ones, like a walk. */
+    node_pointer    _copy_subtree(const_node_pointer src, node_pointer parent,
+                                  node_pointer& reusable) {
+        node_pointer    top = _clone_node(src, parent, reusable);
+
+        try {
+            if (!node_base::is_nil(src->right)) {
+                top->right = _copy_subtree(src->right, top, reusable);
+            }
+            parent = top;
+            src = src->left;
+            while (!node_base::is_nil(src)) {
+                node_pointer    node = _clone_node(src, parent, reusable);
+
+                parent->left = node;
+                if (!node_base::is_nil(src->right)) {
+                    node->right = _copy_subtree(src->right, node, reusable);
+                }
+                parent = node;
+                src = src->left;
+            }
+        } catch (...) {
+            _free_node_list(_flatten(top));
+            throw;
+        }
+        return top;
+    }
+
+    /**
+     * The node taking the removed one's place may be the shared sentinel,
+     * whose parent cannot be written, so its parent is tracked on the side.
+     */
+    void    _unlink(node_pointer node) {
         node_pointer    x;
-        nodeColor       old_color = node->color;
+        node_pointer    x_parent;
+        nodeColor       old_color = node->color();
 
+        _update_extremes_remove(node);
         if (node->left == _nil) {
             x = node->right;
-            _transplant(node, node->right);
+            x_parent = node->parent();
+            _transplant(node, x);
         } else if (node->right == _nil) {
             x = node->left;
-            _transplant(node, node->left);
+            x_parent = node->parent();
+            _transplant(node, x);
         } else {
             node_pointer    y = node_base::minimum(node->right);
-            old_color = y->color;
+            old_color = y->color();
             x = y->right;
-            if (y->parent == node) {
-                x->parent = y;
+            if (y->parent() == node) {
+                x_parent = y;
             } else {
-                _transplant(y, y->right);
+                x_parent = y->parent();
+                _transplant(y, x);
                 y->right = node->right;
-                y->right->parent = y;
+                y->right->set_parent(y);
             }
             _transplant(node, y);
             y->left = node->left;
-            y->left->parent = y;
-            y->color = node->color;
+            y->left->set_parent(y);
+            y->set_color(node->color());
         }
-        _node_allocator.destroy(node);
-        _node_allocator.deallocate(node, 1);
+        _update_path(x_parent);
         if (old_color == black) {
-            _balance_tree_remove(x);
+            _balance_tree_remove(x, x_parent);
         }
-        _update_nil_remove();
         --_size;
-        return true;
     }
 
- private:
-    struct compare_functions {
-        explicit compare_functions(const key_compare& _comp)
-                :   comp(_comp),
-                    less(_comp),
-                    not_less(_comp),
-                    greater(_comp) {}
+    void    _erase_by_rebuild(node_pointer first, node_pointer last) {
+        size_type       kept_size = 0;
+        node_pointer    kept_head = 0;
+        node_pointer    kept_tail = 0;
+        node_pointer    list = _detach_nodes();
+        bool            in_range = false;
 
-        explicit compare_functions(const compare_functions& src)
-                :   comp(src.comp),
-                    less(src.comp),
-                    not_less(src.comp),
-                    greater(src.comp) {}
+        while (list) {
+            node_pointer    next = list->right;
 
-        struct s_greater {
-            key_compare comp;
+            if (list == first) {
+                in_range = true;
+            }
+            if (list == last) {
+                in_range = false;
+            }
+            if (in_range) {
+                _destroy_node(list);
+            } else {
+                if (kept_tail) {
+                    kept_tail->right = list;
+                } else {
+                    kept_head = list;
+                }
+                kept_tail = list;
+                ++kept_size;
+            }
+            list = next;
+        }
+        _link_sorted_list(kept_head, kept_size);
+    }
 
-            explicit s_greater(const key_compare& _comp) : comp(_comp) {}
+    void    _destroy_node(node_pointer node) {
+        _node_allocator.destroy(node);
+        _node_allocator.deallocate(node, 1);
+    }
 
-            bool operator()(const_reference x, const_reference y) const {
-                return comp(y, x);
+    /**
+     * Where insert_unique links a node with key: sets its parent (null for
+     * the root) and side, and returns the equivalent node already in the
+     * tree, if any. The last node we stepped right from is the only
+     * possible duplicate, so one extra comparison settles it.
+     */
+    node_pointer    _unique_position(const key_type& key, node_pointer& parent,
+                                     bool& go_left) const {
+        node_pointer    last_right = 0;
+        node_pointer    x = _root;
+
+        parent = 0;
+        go_left = true;
+        while (x != _nil) {
+            parent = x;
+            go_left = _comp(key, _key(x));
+            if (go_left) {
+                x = x->left;
+            } else {
+                last_right = x;
+                x = x->right;
             }
-        };
+        }
+        if (last_right && !_comp(_key(last_right), key)) {
+            return last_right;
+        }
+        return 0;
+    }
 
-        struct s_not_less {
-            key_compare comp;
+    /* _unique_position() for the hinted insert_unique. */
+    node_pointer    _hint_unique_position(node_pointer hint,
+                                          const key_type& key,
+                                          node_pointer& parent,
+                                          bool& go_left) const {
+        if (hint == _header) {
+            if (_size && _comp(_key(_header->parent()), key)) {
+                return _position(_header->parent(), false, parent, go_left);
+            }
+            return _unique_position(key, parent, go_left);
+        }
+        if (_comp(key, _key(hint))) {
+            if (hint == _leftmost) {
+                return _position(hint, true, parent, go_left);
+            }
+            node_pointer    before = node_base::predecessor(hint);
 
-            explicit s_not_less(const key_compare& _comp) : comp(_comp) {}
+            if (_comp(_key(before), key)) {
+                if (before->right == _nil) {
+                    return _position(before, false, parent, go_left);
+                }
+                return _position(hint, true, parent, go_left);
+            }
+            return _unique_position(key, parent, go_left);
+        }
+        if (_comp(_key(hint), key)) {
+            node_pointer    after = node_base::successor(hint);
 
-            bool operator()(const_reference x, const_reference y) const {
-                return !comp(x, y);
+            if (after == _header) {
+                return _position(hint, false, parent, go_left);
             }
-        };
+            if (_comp(key, _key(after))) {
+                if (hint->right == _nil) {
+                    return _position(hint, false, parent, go_left);
+                }
+                return _position(after, true, parent, go_left);
+            }
+            return _unique_position(key, parent, go_left);
+        }
+        return hint;
+    }
 
-        struct s_less {
-            key_compare comp;
+    /* Sets a free slot found by the hinted search; there is no duplicate. */
+    static node_pointer _position(node_pointer at, bool as_left_child,
+                                  node_pointer& parent, bool& go_left) {
+        parent = at;
+        go_left = as_left_child;
+        return 0;
+    }
 
-            explicit s_less(const key_compare& _comp) : comp(_comp) {}
+    iterator    _insert_at(node_pointer parent, bool as_left_child,
+                           const_reference data) {
+        return _link_at(parent, as_left_child, _create_new_node(data));
+    }
+
+    /* Links the handle's node if both allocators agree, else a copy. */
+    template <typename Handle>
+    iterator    _adopt(node_pointer parent, bool as_left_child,
+                       Handle& handle) {
+        if (handle.get_allocator() == _node_allocator) {
+            return _link_at(parent, as_left_child, handle.release());
+        }
+        iterator    linked = _insert_at(parent, as_left_child, handle.value());
 
-            bool operator()(const_reference x, const_reference y) const {
-                return comp(x, y);
+        handle = Handle();
+        return linked;
+    }
+
+    /* Links a detached node as a new leaf and rebalances. */
+    iterator    _link_at(node_pointer parent, bool as_left_child,
+                         node_pointer node) {
+        node->left = _nil;
+        node->right = _nil;
+        node->set_parent(parent ? parent : _header);
+        node->set_color(red);
+        if (!parent) {
+            _root = node;
+        } else if (as_left_child) {
+            parent->left = node;
+        } else {
+            parent->right = node;
+        }
+        _update_extremes_insert(node, parent, as_left_child);
+        _update_path(node);
+        _balance_tree_insert(node);
+        ++_size;
+        return iterator(node);
+    }
+
+    /* insert_equal, but before the elements equivalent to data. */
+    iterator    _insert_equal_lower(const_reference data) {
+        const key_type& key = KeyOfValue()(data);
+        node_pointer    parent = 0;
+        node_pointer    x = _root;
+        bool            go_left = true;
+
+        while (x != _nil) {
+            parent = x;
+            go_left = !_comp(_key(x), key);
+            x = go_left ? x->left : x->right;
+        }
+        return _insert_at(parent, go_left, data);
+    }
+
+    template <typename InputIt>
+    InputIt _build_sorted_prefix(InputIt first, InputIt last, bool unique) {
+        node_pointer    head = 0;
+        node_pointer    tail = 0;
+        node_pointer    node;
+        size_type       n = 0;
+
+        try {
+            for (; first != last; ++first) {
+                node = _create_new_node(*first);
+                if (tail && !_comp(_key(tail), _key(node))
+                         && (unique || _comp(_key(node), _key(tail)))) {
+                    bool    out_of_order = _comp(_key(node), _key(tail));
+
+                    _destroy_node(node);
+                    if (out_of_order) {
+                        break;
+                    }
+                    continue;
+                }
+                if (tail) {
+                    tail->right = node;
+                } else {
+                    head = node;
+                }
+                tail = node;
+                ++n;
+            }
+        } catch (...) {
+            while (head) {
+                node = head;
+                head = head == tail ? 0 : head->right;
+                _destroy_node(node);
             }
-        };
+            throw;
+        }
+        _link_sorted_list(head, n);
+        return first;
+    }
 
-        key_compare comp;
-        s_less      less;
-        s_not_less  not_less;
-        s_greater   greater;
-    };
+    /**
+     * Links n nodes chained through their right pointers, in order, into a
+     * size-balanced tree. Every level but the deepest is full, so painting
+     * the nodes of that last, partial level red gives a valid coloring.
+     */
+    void    _link_sorted_list(node_pointer head, size_type n) {
+        size_type   red_depth = 0;
 
-    size_type           _size;
-    compare_functions   _comp;
-    node_allocator      _node_allocator;
-    node_pointer        _root;
-    node_pointer        _nil;
+        if (!n) {
+            return;
+        }
+        while ((static_cast<size_type>(2) << red_depth) <= n + 1) {
+            ++red_depth;
+        }
+        _leftmost = head;
+        _root = _build_balanced(head, n, 0, red_depth);
+        _root->set_parent(_header);
+        _header->set_parent(node_base::maximum(_root));
+        _size = n;
+    }
 
-    node_pointer _create_new_node(const_reference data, node_pointer parent) {
-        node_pointer        node = _node_allocator.allocate(1);
+    node_pointer    _build_balanced(node_pointer& list, size_type n,
+                                    size_type depth, size_type red_depth) {
+        if (!n) {
+            return _nil;
+        }
+        size_type       left_size = (n - 1) / 2;
+        node_pointer    left = _build_balanced(list, left_size, depth + 1,
+                                               red_depth);
+        node_pointer    node = list;
+
+        list = list->right;
+        node->left = left;
+        if (left != _nil) {
+            left->set_parent(node);
+        }
+        node->right = _build_balanced(list, n - 1 - left_size, depth + 1,
+                                      red_depth);
+        if (node->right != _nil) {
+            node->right->set_parent(node);
+        }
+        node->set_color(depth == red_depth ? red : black);
+        _update_node(node);
+        return node;
+    }
+
+    void    _merge_by_copy(rb_tree& src) {
+        node_pointer    x = src._leftmost;
+
+        while (x != src._header) {
+            node_pointer    next = node_base::successor(x);
+
+            if (insert_unique(x->data).second) {
+                src.erase(x);
+            }
+            x = next;
+        }
+    }
+
+    void    _merge_by_relink(rb_tree& src) {
+        node_pointer    x = src._leftmost;
+        node_pointer    parent;
+        bool            go_left;
+
+        while (x != src._header) {
+            node_pointer    next = node_base::successor(x);
+
+            if (!_unique_position(_key(x), parent, go_left)) {
+                src._unlink(x);
+                _link_at(parent, go_left, x);
+            }
+            x = next;
+        }
+    }
+
+    /* Number of elements from x to the end, read off subtree sizes. */
+    size_type   _count_from(node_pointer x, ft::true_type) const {
+        return _size - position(x);
+    }
+
+    /**
+     * Number of elements from x to the end, walking from x towards both
+     * ends at once so only the shorter side is ever walked in full.
+     */
+    size_type   _count_from(node_pointer x, ft::false_type) const {
+        node_pointer    forward = x;
+        node_pointer    backward = x;
+        size_type       steps = 0;
+
+        for (;;) {
+            if (forward == _header) {
+                return steps;
+            }
+            if (backward == _leftmost) {
+                return _size - steps;
+            }
+            forward = node_base::successor(forward);
+            backward = node_base::predecessor(backward);
+            ++steps;
+        }
+    }
+
+    size_type   _black_height(node_pointer x) const {
+        size_type   height = 0;
+
+        for (; x != _nil; x = x->left) {
+            height += x->color() == black;
+        }
+        return height;
+    }
+
+    /* Paints a red root black, which adds one to the black height. */
+    void    _blacken(subtree& tree) {
+        if (tree.root != _nil && tree.root->color() == red) {
+            tree.root->set_color(black);
+            ++tree.height;
+        }
+    }
+
+    /**
+     * Splits tree into the elements ordered before key and the others. Each
+     * node on the path to key is joined, with the subtree it hangs on the
+     * far side of the path, onto the piece built below it; the heights of
+     * consecutive joins telescope, so the whole split is O(log n). Given
+     * equal, a node equivalent to key is detached there instead of going
+     * right; equal is left untouched if there is none.
+     */
+    template <typename K>
+    void    _split(subtree tree, const K& key, subtree& left,
+                   subtree& right, node_pointer* equal = 0) {
+        node_pointer    x = tree.root;
+
+        if (x == _nil) {
+            left = tree;
+            right = tree;
+            return;
+        }
+        size_type   child_height = tree.height - (x->color() == black);
+        subtree     below_left = { x->left, child_height };
+        subtree     below_right = { x->right, child_height };
+        subtree     rest;
+
+        if (_comp(_key(x), key)) {
+            _split(below_right, key, rest, right, equal);
+            left = _join(below_left, x, rest);
+        } else if (equal && !_comp(key, _key(x))) {
+            *equal = x;
+            left = below_left;
+            right = below_right;
+        } else {
+            _split(below_left, key, left, rest, equal);
+            right = _join(rest, x, below_right);
+        }
+    }
+
+    /* Joins two subtrees with no node between them, through left's last. */
+    subtree _join_pieces(subtree left, subtree right) {
+        node_pointer    last;
+
+        if (left.root == _nil) {
+            return right;
+        }
+        if (right.root == _nil) {
+            return left;
+        }
+        left = _split_last(left, last);
+        return _join(left, last, right);
+    }
+
+    subtree _split_last(subtree tree, node_pointer& last) {
+        node_pointer    x = tree.root;
+        size_type       child_height = tree.height - (x->color() == black);
+        subtree         below_left = { x->left, child_height };
+        subtree         below_right = { x->right, child_height };
+
+        if (x->right == _nil) {
+            last = x;
+            return below_left;
+        }
+        below_right = _split_last(below_right, last);
+        return _join(below_left, x, below_right);
+    }
 
-        _node_allocator.construct(node, node_base(data, parent, _nil, red));
+    /* Both subtrees are this tree's to consume; theirs loses duplicates. */
+    subtree _unite(subtree mine, subtree theirs, size_type& dropped) {
+        node_pointer    x = mine.root;
+
+        if (x == _nil) {
+            return theirs;
+        }
+        if (theirs.root == _nil) {
+            return mine;
+        }
+        size_type       child_height = mine.height - (x->color() == black);
+        subtree         below_left = { x->left, child_height };
+        subtree         below_right = { x->right, child_height };
+        subtree         theirs_left;
+        subtree         theirs_right;
+        node_pointer    duplicate = 0;
+
+        _split(theirs, _key(x), theirs_left, theirs_right, &duplicate);
+        if (duplicate) {
+            _destroy_node(duplicate);
+            ++dropped;
+        }
+        below_left = _unite(below_left, theirs_left, dropped);
+        below_right = _unite(below_right, theirs_right, dropped);
+        return _join(below_left, x, below_right);
+    }
+
+    subtree _intersect(subtree mine, const_node_pointer theirs,
+                       size_type& dropped) {
+        if (mine.root == _nil) {
+            return mine;
+        }
+        if (theirs == _nil) {
+            dropped += _destroy_subtree(mine.root);
+            mine.root = _nil;
+            mine.height = 0;
+            return mine;
+        }
+        subtree         left;
+        subtree         right;
+        node_pointer    equal = 0;
+
+        _split(mine, _key(theirs), left, right, &equal);
+        left = _intersect(left, theirs->left, dropped);
+        right = _intersect(right, theirs->right, dropped);
+        if (equal) {
+            return _join(left, equal, right);
+        }
+        return _join_pieces(left, right);
+    }
+
+    subtree _subtract(subtree mine, const_node_pointer theirs,
+                      size_type& dropped) {
+        if (mine.root == _nil || theirs == _nil) {
+            return mine;
+        }
+        subtree         left;
+        subtree         right;
+        node_pointer    equal = 0;
+
+        _split(mine, _key(theirs), left, right, &equal);
+        left = _subtract(left, theirs->left, dropped);
+        right = _subtract(right, theirs->right, dropped);
+        if (equal) {
+            _destroy_node(equal);
+            ++dropped;
+        }
+        return _join_pieces(left, right);
+    }
+
+    size_type   _destroy_subtree(node_pointer root) {
+        node_pointer    list = _flatten(root);
+        size_type       n = 0;
+
+        for (; list; ++n) {
+            node_pointer    next = list->right;
+
+            _destroy_node(list);
+            list = next;
+        }
+        return n;
+    }
+
+    /**
+     * Joins left, mid and right, whose elements are ordered in that sequence,
+     * into one subtree. mid is hung from the spine of the taller side where
+     * the black height matches the shorter one, then rebalanced like a new
+     * leaf: O(1 + the difference in black height).
+     */
+    subtree _join(subtree left, node_pointer mid, subtree right) {
+        _blacken(left);
+        _blacken(right);
+        if (left.height == right.height) {
+            _link_children(mid, left.root, right.root);
+            mid->set_parent(_header);
+            mid->set_color(black);
+            _update_node(mid);
+            subtree joined = { mid, left.height + 1 };
+            return joined;
+        }
+        bool            from_left = left.height > right.height;
+        subtree         joined = from_left ? left : right;
+        size_type       height = joined.height;
+        size_type       target = from_left ? right.height : left.height;
+        node_pointer    parent = 0;
+        node_pointer    x = joined.root;
+
+        while (x->color() == red || height != target) {
+            height -= x->color() == black;
+            parent = x;
+            x = from_left ? x->right : x->left;
+        }
+        if (from_left) {
+            _link_children(mid, x, right.root);
+            parent->right = mid;
+        } else {
+            _link_children(mid, left.root, x);
+            parent->left = mid;
+        }
+        mid->set_parent(parent);
+        mid->set_color(red);
+        _root = joined.root;
+        _root->set_parent(_header);
+        _update_path(mid);
+        joined.height += _balance_tree_insert(mid);
+        joined.root = _root;
+        return joined;
+    }
+
+    void    _link_children(node_pointer x, node_pointer left,
+                           node_pointer right) {
+        x->left = left;
+        x->right = right;
+        if (left != _nil) {
+            left->set_parent(x);
+        }
+        if (right != _nil) {
+            right->set_parent(x);
+        }
+    }
+
+    template <typename K>
+    node_pointer    _search(const K& key) const {
+        node_pointer    node = lower_bound(key);
+
+        if (node == _header || _comp(key, _key(node))) {
+            return 0;
+        }
         return node;
     }
 
-    void    _balance_tree_insert(node_pointer node) {
+    /* Returns whether the root had to be painted black, growing the tree. */
+    bool    _balance_tree_insert(node_pointer node) {
         node_pointer    sibling;
         bool            node_is_left_child;
         bool            parent_is_left_child;
 
-        while (node != _root && node->parent->color == red) {
-            sibling = _get_sibling(node->parent);
-            if (sibling->color == red) {
-                sibling->color = black;
-                node->parent->color = black;
-                node->parent->parent->color = red;
-                node = node->parent->parent;
+        while (node != _root && node->parent()->color() == red) {
+            sibling = _get_sibling(node->parent());
+            if (sibling->color() == red) {
+                sibling->set_color(black);
+                node->parent()->set_color(black);
+                node->parent()->parent()->set_color(red);
+                node = node->parent()->parent();
             } else {
                 node_is_left_child = _is_left_child(node);
-                parent_is_left_child = _is_left_child(node->parent);
+                parent_is_left_child = _is_left_child(node->parent());
                 if (node_is_left_child != parent_is_left_child) {
-                    node = node->parent;
+                    node = node->parent();
                     if (node_is_left_child) {
                         _right_rotate(node);
                     } else {
                         _left_rotate(node);
                     }
                 }
-                node->parent->color = black;
-                node->parent->parent->color = red;
+                node->parent()->set_color(black);
+                node->parent()->parent()->set_color(red);
                 if (parent_is_left_child) {
-                    _right_rotate(node->parent->parent);
+                    _right_rotate(node->parent()->parent());
                 } else {
-                    _left_rotate(node->parent->parent);
+                    _left_rotate(node->parent()->parent());
                 }
             }
         }
-        _root->color = black;
+        bool    grew = _root->color() == red;
+
+        _root->set_color(black);
+        return grew;
     }
 
-    void    _balance_tree_remove(node_pointer node) {
+    void    _balance_tree_remove(node_pointer node, node_pointer parent) {
         node_pointer            sibling;
         bool                    node_is_left_child;
         childrenCombinations    combination;
 
-        while (node != _root && node->color == black) {
-            sibling = _get_sibling(node);
-            node_is_left_child = _is_left_child(node);
-            if (sibling->color == red) {
-                sibling->color = black;
-                node->parent->color = red;
+        while (node != _root && node->color() == black) {
+            node_is_left_child = node == parent->left;
+            sibling = node_is_left_child ? parent->right : parent->left;
+            if (sibling->color() == red) {
+                sibling->set_color(black);
+                parent->set_color(red);
                 if (node_is_left_child) {
-                    _left_rotate(node->parent);
-                    sibling = node->parent->right;
+                    _left_rotate(parent);
+                    sibling = parent->right;
                 } else {
-                    _right_rotate(node->parent);
-                    sibling = node->parent->left;
+                    _right_rotate(parent);
+                    sibling = parent->left;
                 }
             }
             combination = _get_children_combination(sibling);
             if (combination == bb) {
-                sibling->color = red;
-                node = node->parent;
+                sibling->set_color(red);
+                node = parent;
+                parent = node->parent();
             } else {
                 if (node_is_left_child) {
                     if (combination == rb) {
-                        sibling->left->color = black;
-                        sibling->color = red;
+                        sibling->left->set_color(black);
+                        sibling->set_color(red);
                         _right_rotate(sibling);
-                        sibling = node->parent->right;
+                        sibling = parent->right;
                     }
-                    sibling->color = node->parent->color;
-                    node->parent->color = black;
-                    sibling->right->color = black;
-                    _left_rotate(node->parent);
+                    sibling->set_color(parent->color());
+                    parent->set_color(black);
+                    sibling->right->set_color(black);
+                    _left_rotate(parent);
                 } else {
                     if (combination == br) {
-                        sibling->right->color = black;
-                        sibling->color = red;
+                        sibling->right->set_color(black);
+                        sibling->set_color(red);
                         _left_rotate(sibling);
-                        sibling = node->parent->left;
+                        sibling = parent->left;
                     }
-                    sibling->color = node->parent->color;
-                    node->parent->color = black;
-                    sibling->left->color = black;
-                    _right_rotate(node->parent);
+                    sibling->set_color(parent->color());
+                    parent->set_color(black);
+                    sibling->left->set_color(black);
+                    _right_rotate(parent);
                 }
                 node = _root;
             }
         }
-        node->color = black;
+        if (node != _nil) {
+            node->set_color(black);
+        }
     }
 
     bool _is_left_child(node_pointer node) {
-        return node == node->parent->left;
+        return node == node->parent()->left;
     }
 
     node_pointer _get_sibling(node_pointer node) {
-        return _is_left_child(node) ? node->parent->right : node->parent->left;
+        node_pointer    parent = node->parent();
+
+        return node == parent->left ? parent->right : parent->left;
     }
 
     childrenCombinations    _get_children_combination(node_pointer node) {
-        if (node->left->color == black) {
-            return node->right->color == black ? bb : br;
+        if (node->left->color() == black) {
+            return node->right->color() == black ? bb : br;
         }
-        return node->right->color == black ? rb : rr;
+        return node->right->color() == black ? rb : rr;
     }
 
     void _left_rotate(node_pointer x) {
@@ -374,18 +1615,20 @@ class rb_tree {
 
         x->right = y->left;
         if (y->left != _nil) {
-            y->left->parent = x;
+            y->left->set_parent(x);
         }
-        y->parent = x->parent;
-        if (!x->parent) {
+        y->set_parent(x->parent());
+        if (x->parent() == _header) {
             _root = y;
-        } else if (x == x->parent->left) {
-            x->parent->left = y;
+        } else if (x == x->parent()->left) {
+            x->parent()->left = y;
         } else {
-            x->parent->right = y;
+            x->parent()->right = y;
         }
         y->left = x;
-        x->parent = y;
+        x->set_parent(y);
+        _update_node(x);
+        _update_node(y);
     }
 
     void _right_rotate(node_pointer x) {
@@ -393,70 +1636,75 @@ class rb_tree {
 
         x->left = y->right;
         if (y->right != _nil) {
-            y->right->parent = x;
+            y->right->set_parent(x);
         }
-        y->parent = x->parent;
-        if (!x->parent) {
+        y->set_parent(x->parent());
+        if (x->parent() == _header) {
             _root = y;
-        } else if (x == x->parent->right) {
-            x->parent->right = y;
+        } else if (x == x->parent()->right) {
+            x->parent()->right = y;
         } else {
-            x->parent->left = y;
+            x->parent()->left = y;
         }
         y->right = x;
-        x->parent = y;
+        x->set_parent(y);
+        _update_node(x);
+        _update_node(y);
     }
 
     void _transplant(node_pointer node, node_pointer replacement) {
-        if (node->parent == 0) {
+        if (node->parent() == _header) {
             _root = replacement;
-        } else if (node == node->parent->left) {
-            node->parent->left = replacement;
+        } else if (node == node->parent()->left) {
+            node->parent()->left = replacement;
         } else {
-            node->parent->right = replacement;
+            node->parent()->right = replacement;
         }
-        replacement->parent = node->parent;
-    }
-
-    void _clear_recursive(node_pointer node) {
-        if (node != _nil) {
-            _clear_recursive(node->left);
-            _clear_recursive(node->right);
-            _node_allocator.destroy(node);
-            _node_allocator.deallocate(node, 1);
+        if (replacement != _nil) {
+            replacement->set_parent(node->parent());
         }
-        _root = _nil;
     }
 
-    template <typename function>
-    node_pointer _find_bound(const_reference to_compare,
-                             const function& condition) {
-        node_pointer    x = _root;
-        node_pointer    last_occurency = _nil;
-
-        while (x != _nil) {
-            if (condition(x->data, to_compare)) {
-                last_occurency = x;
-                x = x->left;
-            } else {
-                x = x->right;
+    /**
+     * The leftmost node is cached for begin(), the rightmost one lives in
+     * the header's parent for --end(). Both only move when a node is
+     * linked below them or when they are themselves removed.
+     */
+    void    _update_extremes_insert(node_pointer node, node_pointer parent,
+                                    bool as_left_child) {
+        if (!parent) {
+            _leftmost = node;
+            _header->set_parent(node);
+        } else if (as_left_child) {
+            if (parent == _leftmost) {
+                _leftmost = node;
             }
+        } else if (parent == _header->parent()) {
+            _header->set_parent(node);
         }
-        return last_occurency;
     }
 
-    void    _update_nil_insert(node_pointer node) {
-        if (!_size || _comp.less(_nil->parent->data, node->data)) {
-            _nil->parent = node;
+    void    _update_extremes_remove(node_pointer node) {
+        if (node == _leftmost) {
+            _leftmost = node_base::successor(node);
+        }
+        if (node == _header->parent()) {
+            _header->set_parent(node_base::predecessor(node));
         }
     }
 
-    void    _update_nil_remove(void) {
-        _nil->parent = node_base::maximum(_root);
+    void    _update_node(node_pointer x) {
+        NodeUpdate()(x);
     }
 
-    bool    _is_nil(node_pointer node) {
-        return !node || node == _nil;
+    /* Recomputes the metadata of x and of all its ancestors, bottom-up. */
+    void    _update_path(node_pointer x) {
+        if (!_augmented) {
+            return;
+        }
+        for (; x != _header; x = x->parent()) {
+            NodeUpdate()(x);
+        }
     }
 };  /* class rb_tree */
 
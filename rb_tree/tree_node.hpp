@@ -3,81 +3,148 @@
 #ifndef RB_TREE_TREE_NODE_HPP_
 #define RB_TREE_TREE_NODE_HPP_
 
+#include <cstddef>
+
 #include "./enums.hpp"
 
 namespace ft {
 
-template <typename T>
-struct node {
+/**
+ * Storage for the metadata a node update policy keeps in each node. Trees
+ * without a policy use the empty specialization, which costs no space.
+ */
+template <typename Metadata>
+struct node_metadata {
+    Metadata    metadata;
+
+    node_metadata() : metadata() {}
+};
+
+template <>
+struct node_metadata<void> {};
+
+/**
+ * Compact red-black tree node. Leaves point to a black sentinel shared by
+ * every tree of the same node type, so subtrees can be moved from one tree
+ * to another as they are. The sentinel, and each tree's header (its end()
+ * node), are the only nodes whose children point back to themselves. The
+ * color lives in the low bit of the parent pointer, which node alignment
+ * always leaves clear.
+ */
+template <typename T, typename Metadata = void>
+struct node : public node_metadata<Metadata> {
+    typedef T           value_type;
     typedef node*       node_pointer;
-    T               data;
     node_pointer    left;
     node_pointer    right;
-    node_pointer    parent;
-    node_pointer    leaf;
-    nodeColor       color;
+    T               data;
 
     node(const T&       _data = T(),
          node_pointer   _parent = 0,
          node_pointer   _leaf = 0,
          nodeColor      _color = black)
-                    :   data(_data),
+                    :   node_metadata<Metadata>(),
                         left(_leaf),
                         right(_leaf),
-                        parent(_parent),
-                        leaf(_leaf),
-                        color(_color) {}
+                        data(_data),
+                        _parent_and_color(_pack(_parent, _color)) {}
+
+    node_pointer    parent(void) const {
+        return reinterpret_cast<node_pointer>(_parent_and_color & ~color_bit);
+    }
+
+    nodeColor       color(void) const {
+        return static_cast<nodeColor>(_parent_and_color & color_bit);
+    }
+
+    void    set_parent(node_pointer parent) {
+        _parent_and_color = _pack(parent, color());
+    }
+
+    void    set_color(nodeColor color) {
+        _parent_and_color = (_parent_and_color & ~color_bit) | color;
+    }
+
+    static bool is_nil(const node* x) {
+        return x->left == x;
+    }
+
+    /**
+     * The shared leaf sentinel. Trees never write to it: its color and
+     * metadata stay those of an empty subtree.
+     */
+    static node_pointer leaf(void) {
+        static sentinel shared;
+
+        return &shared;
+    }
 
     static node_pointer minimum(node_pointer node) {
-        while (node->left != node->leaf) {
+        while (!is_nil(node->left)) {
             node = node->left;
         }
         return node;
     }
 
     static node_pointer maximum(node_pointer node) {
-        while (node->right != node->leaf) {
+        while (!is_nil(node->right)) {
             node = node->right;
         }
         return node;
     }
 
+    /**
+     * The root's parent is the tree's header, whose children are itself, so
+     * climbing past the maximum stops there, i.e. at end().
+     */
     static node_pointer successor(node_pointer x) {
-        if (x->right != x->leaf) {
+        if (!is_nil(x->right)) {
             return minimum(x->right);
         }
-        if (x->_is_last_node()) {
-            return x->leaf;
-        }
-        node_pointer y = x->parent;
-        while (y != y->leaf && x == y->right) {
+        node_pointer y = x->parent();
+        while (x == y->right) {
             x = y;
-            y = y->parent;
+            y = y->parent();
         }
         return y;
     }
 
+    /* The header's parent is kept on the maximum, making --end() valid. */
     static node_pointer predecessor(node_pointer x) {
-        if (x->left != x->leaf) {
-            return maximum(x->left);
+        if (is_nil(x)) {
+            return x->parent();
         }
-        if (x->parent->_is_last_node()) {
-            return x->parent;
+        if (!is_nil(x->left)) {
+            return maximum(x->left);
         }
-        node_pointer y = x->parent;
-        while (y != y->leaf && x == y->left) {
+        node_pointer y = x->parent();
+        while (x == y->left) {
             x = y;
-            y = y->parent;
+            y = y->parent();
         }
         return y;
     }
 
  private:
-    bool _is_last_node(void) {
-        return this->leaf->parent == this;
+    static const std::size_t    color_bit = 1;
+
+    struct sentinel;
+
+    std::size_t     _parent_and_color;
+
+    static std::size_t  _pack(node_pointer parent, nodeColor color) {
+        return reinterpret_cast<std::size_t>(parent) | color;
     }
 };  /* struct node */
 
+template <typename T, typename Metadata>
+struct node<T, Metadata>::sentinel : public node<T, Metadata> {
+    sentinel() {
+        this->left = this;
+        this->right = this;
+    }
+};
+
 }   /* namespace ft */
 
 #endif  /* RB_TREE_TREE_NODE_HPP_ */
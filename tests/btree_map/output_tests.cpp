@@ -0,0 +1,214 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/btree_map_tests.hpp"
+
+static void constructorsTest(void);
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void iteratorsTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    insertTest();
+    lookupTest();
+    eraseTest();
+    iteratorsTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+static t_ftIntPair element(int i) {
+    return ft::make_pair(g_array[i], i);
+}
+
+static void fill(t_ftBtreeMap* m) {
+    for (int i = 0; i < g_array_size; ++i) {
+        m->insert(element(i));
+    }
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftBtreeMap    m1;
+
+        fill(&m1);
+
+        t_ftBtreeMap    m2(m1.begin(), m1.end());
+
+        printContainer(m2, print);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftBtreeMap    m1;
+
+        fill(&m1);
+
+        t_ftBtreeMap    m2(m1);
+        t_ftBtreeMap    m3;
+
+        m3[-1] = -1;
+        m3 = m2;
+        printContainer(m2, print);
+        printContainer(m3, print);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\ninsert single elements\n";
+        t_ftBtreeMap    m;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            std::cout << m.insert(element(i)).second;
+        }
+        for (int i = 0; i < g_array_size; ++i) {
+            std::cout << m.insert(element(i)).second;
+        }
+        std::cout << '\n';
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\ninsert with hint (at end())\n";
+        t_ftBtreeMap    m;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.end(), ft::make_pair(i * 3, i));
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (at begin())\n";
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.begin(), ft::make_pair(i * 3 + 1, i));
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (at lower_bound())\n";
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.lower_bound(i * 3 + 2), ft::make_pair(i * 3 + 2, i));
+        }
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\noperator[]\n";
+        t_ftBtreeMap    m;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            m[g_array[i] % (g_array_size / 3 + 1)] += i;
+        }
+        printContainer(m, print);
+    }
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    t_ftBtreeMap    m;
+
+    fill(&m);
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = 0; i < g_array_size; ++i) {
+        int             key = g_array[i] + (i % 2);
+        t_ftIterator    found = m.find(key);
+        t_ftIterator    lower = m.lower_bound(key);
+        t_ftIterator    upper = m.upper_bound(key);
+
+        std::cout << "key " << key << " count " << m.count(key);
+        if (found != m.end()) {
+            std::cout << " find " << found->second;
+        }
+        if (lower != m.end()) {
+            std::cout << " lower " << lower->first;
+        }
+        if (upper != m.end()) {
+            std::cout << " upper " << upper->first;
+        }
+        std::cout << '\n';
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    t_ftBtreeMap    m;
+
+    fill(&m);
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nerase(key)\n";
+        for (int i = 0; i < g_array_size; i += 3) {
+            std::cout << m.erase(g_array[i]) << m.erase(g_array[i]) << ' ';
+        }
+        std::cout << '\n';
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\nerase(iterator)\n";
+        for (int i = 1; i < g_array_size; i += 3) {
+            t_ftIterator    it = m.lower_bound(g_array[i]);
+
+            if (it != m.end()) {
+                m.erase(it);
+            }
+        }
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\nerase(first, last)\n";
+        m.erase(m.lower_bound(g_array_size / 4),
+                m.lower_bound(g_array_size / 2));
+        printContainer(m, print);
+        m.erase(m.begin(), m.end());
+        printContainer(m, print);
+    }
+    printTime(1);
+}
+
+static void iteratorsTest(void) {
+    t_ftBtreeMap    m;
+
+    fill(&m);
+    std::cout << "\n[ ITERATORS ]\n";
+    printTime(0);
+    for (t_ftReverseIterator it = m.rbegin(); it != m.rend(); ++it) {
+        print(*it);
+    }
+    std::cout << '\n';
+    for (t_ftIterator it = m.begin(); it != m.end(); ++it) {
+        it->second *= 2;
+    }
+    printContainer(m, print);
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftBtreeMap    m1;
+
+    fill(&m1);
+
+    t_ftBtreeMap    m2(m1);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << (m1 == m2) << (m1 != m2) << (m1 < m2) << (m1 <= m2)
+              << (m1 > m2) << (m1 >= m2) << '\n';
+    m2.erase(m2.begin());
+    std::cout << (m1 == m2) << (m1 != m2) << (m1 < m2) << (m1 <= m2)
+              << (m1 > m2) << (m1 >= m2) << '\n';
+    m1.swap(m2);
+    std::cout << (m1 == m2) << (m1 != m2) << (m1 < m2) << (m1 <= m2)
+              << (m1 > m2) << (m1 >= m2) << '\n';
+    printTime(1);
+}
@@ -0,0 +1,336 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/btree_map_tests.hpp"
+
+static void insertTest(void);
+static void throwingCopyTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void iteratorsTest(void);
+static void copySwapTest(void);
+static void elementAccessTest(void);
+static void relationalOperatorsTest(void);
+
+/* Enough elements for the tree to grow a few levels of internal nodes. */
+const int   g_size = 20000;
+
+static void fill(t_ftBtreeMap* ftM, t_stdMap* stdM, int size) {
+    srand(size);
+    for (int i = 0; i < size; ++i) {
+        int key = rand() % (size * 2);
+
+        ftM->insert(ft::make_pair(key, i));
+        stdM->insert(std::make_pair(key, i));
+    }
+}
+
+/* Copying an s_throwing throws once g_copies_left copies have been made. */
+static int  g_copies_left = -1;
+
+template <int Tag>
+struct s_throwing {
+    int value;
+
+    explicit s_throwing(int v = 0) : value(v) {}
+    s_throwing(const s_throwing& src) : value(src.value) {
+        if (g_copies_left >= 0 && g_copies_left-- == 0) {
+            throw std::runtime_error("copy");
+        }
+    }
+};
+
+/* Tag 1 moves byte for byte, so the tree only ever copies the new value. */
+namespace ft {
+template <> struct is_trivially_relocatable<s_throwing<1> > : true_type {};
+}
+
+/**
+ * Inserts random keys while copies keep failing partway, some inside the
+ * splits, then checks that every failed insertion left the tree as it was.
+ */
+template <int Tag>
+static bool survivesThrowingCopies(void) {
+    ft::btree_map<int, s_throwing<Tag> >    ftM;
+    t_stdMap                                stdM;
+    bool                                    thrown = false;
+
+    srand(g_size);
+    for (int i = 0; i < g_size; ++i) {
+        int key = rand() % (g_size * 2);
+
+        g_copies_left = rand() % 8;
+        try {
+            ftM.insert(ft::make_pair(key, s_throwing<Tag>(i)));
+            stdM.insert(std::make_pair(key, i));
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        g_copies_left = -1;
+    }
+    for (int key = 0; key < g_size * 2; key += 3) {
+        ftM.erase(key);
+        stdM.erase(key);
+    }
+    bool    same = thrown && ftM.size() == stdM.size();
+    t_stdIterator   stdIt = stdM.begin();
+
+    for (typename ft::btree_map<int, s_throwing<Tag> >::iterator it
+            = ftM.begin(); same && it != ftM.end(); ++it, ++stdIt) {
+        same = it->first == stdIt->first
+            && it->second.value == stdIt->second;
+    }
+    return same;
+}
+
+int main(void) {
+    insertTest();
+    throwingCopyTest();
+    lookupTest();
+    eraseTest();
+    iteratorsTest();
+    copySwapTest();
+    elementAccessTest();
+    relationalOperatorsTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftBtreeMap    ftM;
+    t_stdMap        stdM;
+
+    printColor(BGWHITE, "\n├─ insert (random keys, duplicates rejected)\n");
+    fill(&ftM, &stdM, g_size);
+    printStatus(compare_containers(ftM, stdM, equal<int>));
+    ft::pair<t_ftIterator, bool>    ret = ftM.insert(ft::make_pair(7, -1));
+    printStatus(!ret.second && ret.first->first == 7
+                && ret.first->second == stdM[7]);
+
+    printColor(BGWHITE, "\n├─ insert range\n");
+    {
+        t_ftBtreeMap    rangeM(ftM.begin(), ftM.end());
+        printStatus(compare_containers(rangeM, stdM, equal<int>));
+    }
+
+    printColor(BGWHITE, "\n├─ insert with hint (sorted input at end())\n");
+    {
+        t_ftBtreeMap    hintM;
+        t_stdMap        hintStdM;
+        bool            placed = true;
+
+        for (int i = 0; i < g_size; ++i) {
+            t_ftIterator    it = hintM.insert(hintM.end(),
+                                              ft::make_pair(i * 3, i));
+            hintStdM.insert(hintStdM.end(), std::make_pair(i * 3, i));
+            placed = placed && it->first == i * 3;
+        }
+        printStatus(placed
+                    && compare_containers(hintM, hintStdM, equal<int>));
+
+        for (int i = 0; i < g_size; ++i) {
+            hintM.insert(hintM.lower_bound(i * 3 + 1),
+                         ft::make_pair(i * 3 + 1, i));
+            hintStdM.insert(hintStdM.lower_bound(i * 3 + 1),
+                            std::make_pair(i * 3 + 1, i));
+            hintM.insert(hintM.begin(), ft::make_pair(i * 3 + 2, i));
+            hintStdM.insert(hintStdM.begin(), std::make_pair(i * 3 + 2, i));
+        }
+        printStatus(compare_containers(hintM, hintStdM, equal<int>));
+    }
+}
+
+static void throwingCopyTest(void) {
+    printColor(CYAN, "\n[ THROWING COPIES ]\n");
+
+    printColor(BGWHITE, "\n├─ failed inserts change nothing (copied)\n");
+    printStatus(survivesThrowingCopies<0>());
+
+    printColor(BGWHITE, "\n├─ failed inserts change nothing (relocated)\n");
+    printStatus(survivesThrowingCopies<1>());
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_ftBtreeMap        ftM;
+    t_stdMap            stdM;
+    const t_ftBtreeMap& constM = ftM;
+    bool                same = true;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ find and count\n");
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftConstIterator   it = constM.find(key);
+        t_stdIterator       stdIt = stdM.find(key);
+
+        same = same && ftM.count(key) == stdM.count(key)
+                    && (it == constM.end()) == (stdIt == stdM.end())
+                    && (it == constM.end() || equal(*it, *stdIt));
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ lower_bound, upper_bound and equal_range\n");
+    same = true;
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftRange       range = ftM.equal_range(key);
+        t_stdIterator   lower = stdM.lower_bound(key);
+        t_stdIterator   upper = stdM.upper_bound(key);
+
+        same = same && range.first == ftM.lower_bound(key)
+                    && range.second == ftM.upper_bound(key)
+                    && (range.first == ftM.end()) == (lower == stdM.end())
+                    && (range.second == ftM.end()) == (upper == stdM.end())
+                    && (lower == stdM.end() || equal(*range.first, *lower))
+                    && (upper == stdM.end() || equal(*range.second, *upper));
+    }
+    printStatus(same);
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    t_ftBtreeMap    ftM;
+    t_stdMap        stdM;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ erase(key) returns the number erased\n");
+    bool            same = true;
+    for (int key = 0; key < g_size * 2; key += 3) {
+        same = same && ftM.erase(key) == stdM.erase(key);
+    }
+    printStatus(same && compare_containers(ftM, stdM, equal<int>));
+
+    printColor(BGWHITE, "\n├─ erase(iterator) from internal nodes too\n");
+    for (int i = 0; i < g_size / 4; ++i) {
+        t_ftIterator    it = ftM.lower_bound(i * 5);
+        t_stdIterator   stdIt = stdM.lower_bound(i * 5);
+
+        if (stdIt != stdM.end()) {
+            ftM.erase(it);
+            stdM.erase(stdIt);
+        }
+    }
+    printStatus(compare_containers(ftM, stdM, equal<int>));
+
+    printColor(BGWHITE, "\n├─ erase(first, last)\n");
+    ftM.erase(ftM.lower_bound(g_size / 2), ftM.lower_bound(g_size));
+    stdM.erase(stdM.lower_bound(g_size / 2), stdM.lower_bound(g_size));
+    printStatus(compare_containers(ftM, stdM, equal<int>));
+
+    printColor(BGWHITE, "\n├─ erase down to empty\n");
+    while (!ftM.empty()) {
+        ftM.erase(ftM.begin());
+    }
+    printStatus(ftM.size() == 0 && ftM.begin() == ftM.end());
+    ftM.insert(ft::make_pair(1, 1));
+    printStatus(ftM.size() == 1 && ftM.begin()->first == 1);
+}
+
+static void iteratorsTest(void) {
+    printColor(CYAN, "\n[ ITERATORS ]\n");
+    t_ftBtreeMap    ftM;
+    t_stdMap        stdM;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ reverse iteration\n");
+    t_ftReverseIterator                 rit = ftM.rbegin();
+    bool                                same = true;
+    for (t_stdMap::reverse_iterator stdRit = stdM.rbegin();
+            stdRit != stdM.rend(); ++stdRit, ++rit) {
+        same = same && equal(*rit, *stdRit);
+    }
+    printStatus(same && rit == ftM.rend());
+
+    printColor(BGWHITE, "\n├─ --end() and ++ back to end()\n");
+    t_ftIterator    last = --ftM.end();
+    printStatus(last->first == stdM.rbegin()->first && ++last == ftM.end());
+
+    printColor(BGWHITE, "\n├─ writing through an iterator\n");
+    for (t_ftIterator it = ftM.begin(); it != ftM.end(); ++it) {
+        it->second = -it->first;
+    }
+    for (t_stdIterator it = stdM.begin(); it != stdM.end(); ++it) {
+        it->second = -it->first;
+    }
+    printStatus(compare_containers(ftM, stdM, equal<int>));
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_ftStrBtreeMap     ftM;
+    t_stdStrMap         stdM;
+    std::stringstream   ss;
+
+    for (int i = 0; i < g_size; ++i) {
+        std::string key;
+
+        ss.clear();
+        ss << (i * 7919) % g_size, ss >> key;
+        ftM.insert(ft::make_pair(key, i));
+        stdM.insert(std::make_pair(key, i));
+    }
+    printColor(BGWHITE, "\n├─ copy constructor and assignment\n");
+    t_ftStrBtreeMap     copy(ftM);
+    t_ftStrBtreeMap     assigned;
+
+    assigned.insert(ft::make_pair(std::string("x"), 1));
+    assigned = copy;
+    printStatus(compare_containers(copy, stdM, equal<std::string>)
+                && compare_containers(assigned, stdM, equal<std::string>));
+
+    printColor(BGWHITE, "\n├─ the copy is independent\n");
+    copy.erase(copy.begin(), copy.find("5"));
+    printStatus(compare_containers(ftM, stdM, equal<std::string>)
+                && copy.size() < ftM.size());
+
+    printColor(BGWHITE, "\n├─ swap\n");
+    t_ftStrBtreeMap     other;
+
+    other.insert(ft::make_pair(std::string("only"), 1));
+    ft::swap(other, ftM);
+    printStatus(compare_containers(other, stdM, equal<std::string>)
+                && ftM.size() == 1 && ftM.begin()->first == "only");
+}
+
+static void elementAccessTest(void) {
+    printColor(CYAN, "\n[ ELEMENT ACCESS ]\n");
+    t_ftBtreeMap    ftM;
+    t_stdMap        stdM;
+
+    printColor(BGWHITE, "\n├─ operator[]\n");
+    for (int i = 0; i < g_size; ++i) {
+        ftM[i % 1000] += i;
+        stdM[i % 1000] += i;
+    }
+    printStatus(compare_containers(ftM, stdM, equal<int>));
+
+    printColor(BGWHITE, "\n├─ at() throws on missing keys\n");
+    bool    thrown = false;
+    try {
+        ftM.at(1000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    printStatus(thrown && ftM.at(999) == stdM.at(999) && ftM.size() == 1000);
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_ftBtreeMap    ftM;
+    t_stdMap        stdM;
+
+    fill(&ftM, &stdM, g_size);
+    t_ftBtreeMap    ftOther(ftM);
+    t_stdMap        stdOther(stdM);
+
+    printStatus(ftM == ftOther && !(ftM != ftOther) && ftM <= ftOther
+                && ftM >= ftOther && !(ftM < ftOther) && !(ftM > ftOther));
+    ftOther.erase(--ftOther.end());
+    stdOther.erase(--stdOther.end());
+    printStatus((ftM < ftOther) == (stdM < stdOther)
+                && (ftM > ftOther) == (stdM > stdOther)
+                && (ftM == ftOther) == (stdM == stdOther));
+    ftOther[-1] = 0;
+    stdOther[-1] = 0;
+    printStatus((ftM < ftOther) == (stdM < stdOther)
+                && (ftM >= ftOther) == (stdM >= stdOther));
+}
@@ -0,0 +1,131 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/btree_set_tests.hpp"
+
+static void constructorsTest(void);
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    insertTest();
+    lookupTest();
+    eraseTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftBtreeSet    s(g_array, g_array + g_array_size);
+
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftBtreeSet    s1(g_array, g_array + g_array_size);
+        t_ftBtreeSet    s2(s1);
+        t_ftBtreeSet    s3;
+
+        s3.insert(-1);
+        s3 = s2;
+        printContainer(s2, print<int>);
+        printContainer(s3, print<int>);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\ninsert single elements\n";
+        t_ftBtreeSet    s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            std::cout << s.insert(g_array[i] / 2).second;
+        }
+        std::cout << '\n';
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\ninsert with hint (at end() and begin())\n";
+        t_ftBtreeSet    s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(s.end(), i * 2);
+        }
+        for (int i = g_array_size; i > 0; --i) {
+            s.insert(s.begin(), i * 2 - 1);
+        }
+        printContainer(s, print<int>);
+    }
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    t_ftBtreeSet    s;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        s.insert(g_array[i] * 2);
+    }
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = -1; i <= g_array_size * 2; ++i) {
+        t_ftIterator    lower = s.lower_bound(i);
+        t_ftIterator    upper = s.upper_bound(i);
+
+        std::cout << i << ": " << s.count(i) << (s.find(i) != s.end())
+                  << ' ' << (lower != s.end() ? *lower : -1)
+                  << ' ' << (upper != s.end() ? *upper : -1) << '\n';
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    t_ftBtreeSet    s(g_array, g_array + g_array_size);
+
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nerase(key) and erase(iterator)\n";
+        for (int i = 0; i < g_array_size; i += 2) {
+            std::cout << s.erase(g_array[i]);
+            if (s.lower_bound(g_array[i]) != s.end()) {
+                s.erase(s.lower_bound(g_array[i]));
+            }
+        }
+        std::cout << '\n';
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nerase(first, last)\n";
+        s.erase(s.begin(), s.lower_bound(g_array_size / 2));
+        printContainer(s, print<int>);
+    }
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftBtreeSet    s1(g_array, g_array + g_array_size);
+    t_ftBtreeSet    s2(s1);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << (s1 == s2) << (s1 != s2) << (s1 < s2) << (s1 <= s2)
+              << (s1 > s2) << (s1 >= s2) << '\n';
+    s2.erase(--s2.end());
+    std::cout << (s1 == s2) << (s1 != s2) << (s1 < s2) << (s1 <= s2)
+              << (s1 > s2) << (s1 >= s2) << '\n';
+    printTime(1);
+}
@@ -0,0 +1,159 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/flat_set_tests.hpp"
+
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void copySwapTest(void);
+static void relationalOperatorsTest(void);
+
+/* Single insertions shift the vector: keep this quadratic work bounded. */
+const int   g_size = 5000;
+
+static void fill(t_ftFlatSet* ftS, t_stdSet* stdS, int size) {
+    srand(size);
+    for (int i = 0; i < size; ++i) {
+        int key = rand() % (size * 2);
+
+        ftS->insert(key);
+        stdS->insert(key);
+    }
+}
+
+int main(void) {
+    insertTest();
+    lookupTest();
+    eraseTest();
+    copySwapTest();
+    relationalOperatorsTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftFlatSet     ftS;
+    t_stdSet        stdS;
+
+    printColor(BGWHITE, "\n├─ insert (random keys, duplicates rejected)\n");
+    fill(&ftS, &stdS, g_size);
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+    ft::pair<t_ftIterator, bool>    ret = ftS.insert(*stdS.begin());
+    printStatus(!ret.second && ret.first == ftS.begin());
+
+    printColor(BGWHITE, "\n├─ insert range and descending hints\n");
+    t_ftFlatSet     rangeS(stdS.begin(), stdS.end());
+    printStatus(compare_containers(rangeS, stdS, compare<int>));
+    for (int i = g_size * 3; i > g_size * 2; --i) {
+        rangeS.insert(rangeS.begin(), i);
+        stdS.insert(stdS.begin(), i);
+    }
+    printStatus(compare_containers(rangeS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ insert range merged into stored keys\n");
+    std::vector<int>    incoming;
+
+    for (int i = 0; i < g_size; ++i) {
+        incoming.push_back(rand() % (g_size * 4) - 10);
+    }
+    rangeS.insert(incoming.begin(), incoming.end());
+    stdS.insert(incoming.begin(), incoming.end());
+    printStatus(compare_containers(rangeS, stdS, compare<int>));
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_ftFlatSet     ftS;
+    t_stdSet        stdS;
+    bool            same = true;
+
+    fill(&ftS, &stdS, g_size);
+    printColor(BGWHITE, "\n├─ find, count and bounds\n");
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftIterator    lower = ftS.lower_bound(key);
+        t_ftIterator    upper = ftS.upper_bound(key);
+        t_stdIterator   stdLower = stdS.lower_bound(key);
+        t_stdIterator   stdUpper = stdS.upper_bound(key);
+
+        same = same && ftS.count(key) == stdS.count(key)
+                    && (ftS.find(key) == ftS.end()) == !stdS.count(key)
+                    && (lower == ftS.end() ? stdLower == stdS.end()
+                                           : *lower == *stdLower)
+                    && (upper == ftS.end() ? stdUpper == stdS.end()
+                                           : *upper == *stdUpper);
+    }
+    printStatus(same);
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    t_ftFlatSet     ftS;
+    t_stdSet        stdS;
+    bool            same = true;
+
+    fill(&ftS, &stdS, g_size);
+    printColor(BGWHITE, "\n├─ erase(key) and erase(iterator)\n");
+    for (int key = 0; key < g_size * 2; key += 2) {
+        same = same && ftS.erase(key) == stdS.erase(key);
+        if (ftS.upper_bound(key) != ftS.end()) {
+            ftS.erase(ftS.upper_bound(key));
+            stdS.erase(stdS.upper_bound(key));
+        }
+    }
+    printStatus(same && compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) until empty\n");
+    while (!ftS.empty()) {
+        t_ftIterator    last = ftS.begin();
+        t_stdIterator   stdLast = stdS.begin();
+
+        for (int i = 0; i < 100 && last != ftS.end(); ++i, ++stdLast) {
+            ++last;
+        }
+        ftS.erase(ftS.begin(), last);
+        stdS.erase(stdS.begin(), stdLast);
+        same = same && compare_containers(ftS, stdS, compare<int>);
+    }
+    printStatus(same && stdS.empty() && ftS.begin() == ftS.end());
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_ftFlatSet     ftS;
+    t_stdSet        stdS;
+
+    fill(&ftS, &stdS, g_size);
+    t_ftFlatSet     copy(ftS);
+    t_ftFlatSet     other;
+
+    other.insert(-1);
+    printColor(BGWHITE, "\n├─ copy constructor\n");
+    printStatus(compare_containers(copy, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ swap\n");
+    ft::swap(copy, other);
+    printStatus(compare_containers(other, stdS, compare<int>)
+                && copy.size() == 1 && *copy.begin() == -1);
+
+    printColor(BGWHITE, "\n├─ assignment over a non-empty set\n");
+    copy = other;
+    printStatus(compare_containers(copy, stdS, compare<int>));
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_ftFlatSet     ftS;
+    t_stdSet        stdS;
+
+    fill(&ftS, &stdS, g_size);
+    t_ftFlatSet     ftOther(ftS);
+    t_stdSet        stdOther(stdS);
+
+    printStatus(ftS == ftOther && !(ftS < ftOther) && ftS >= ftOther);
+    ftOther.erase(ftOther.begin());
+    stdOther.erase(stdOther.begin());
+    printStatus((ftS < ftOther) == (stdS < stdOther)
+                && (ftS != ftOther) == (stdS != stdOther)
+                && (ftS > ftOther) == (stdS > stdOther));
+}
@@ -0,0 +1,101 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/frozen_set_tests.hpp"
+
+static void constructorsTest(void);
+static void iteratorsTest(void);
+static void lookupTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    iteratorsTest();
+    lookupTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftFrozenSet   s(g_array, g_array + g_array_size);
+
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nFrom a set\n";
+        ft::set<int>    set(g_array, g_array + g_array_size);
+        t_ftFrozenSet   s(set.begin(), set.end());
+
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftFrozenSet   s1(g_array, g_array + g_array_size);
+        t_ftFrozenSet   s2(s1);
+        t_ftFrozenSet   s3(g_array, g_array + 1);
+
+        s3 = s2;
+        printContainer(s2, print<int>);
+        printContainer(s3, print<int>);
+    }
+    printTime(1);
+}
+
+static void iteratorsTest(void) {
+    t_ftFrozenSet   s(g_array, g_array + g_array_size);
+
+    std::cout << "\n[ ITERATORS ]\n";
+    printTime(0);
+    for (t_ftReverseIterator it = s.rbegin(); it != s.rend(); ++it) {
+        std::cout << *it << ' ';
+    }
+    std::cout << '\n';
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    std::vector<int>    keys;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        keys.push_back(g_array[i] * 2);
+    }
+
+    t_ftFrozenSet   s(keys.begin(), keys.end());
+
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = -1; i <= g_array_size * 2; ++i) {
+        t_ftIterator    lower = s.lower_bound(i);
+        t_ftIterator    upper = s.upper_bound(i);
+        t_ftRange       range = s.equal_range(i);
+
+        std::cout << i << ": " << s.count(i) << (s.find(i) != s.end())
+                  << ' ' << (lower != s.end() ? *lower : -1)
+                  << ' ' << (upper != s.end() ? *upper : -1)
+                  << ' ' << (range.first == lower) << (range.second == upper)
+                  << '\n';
+    }
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftFrozenSet   s1(g_array, g_array + g_array_size);
+    t_ftFrozenSet   s2(s1);
+    t_ftFrozenSet   s3(g_array, g_array + g_array_size / 2);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << (s1 == s2) << (s1 != s2) << (s1 < s2) << (s1 <= s2)
+              << (s1 > s2) << (s1 >= s2) << '\n';
+    std::cout << (s1 == s3) << (s1 != s3) << (s1 < s3) << (s1 <= s3)
+              << (s1 > s3) << (s1 >= s3) << '\n';
+    printTime(1);
+}
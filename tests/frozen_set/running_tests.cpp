@@ -0,0 +1,182 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/frozen_set_tests.hpp"
+
+static void constructorsTest(void);
+static void iteratorsTest(void);
+static void lookupTest(void);
+static void copySwapTest(void);
+static void relationalOperatorsTest(void);
+
+const int   g_size = 100000;
+
+static std::vector<int> randomKeys(t_stdSet* stdS, int size) {
+    std::vector<int>    keys;
+
+    srand(size);
+    for (int i = 0; i < size; ++i) {
+        keys.push_back(rand() % (size * 2));
+        stdS->insert(keys.back());
+    }
+    return keys;
+}
+
+/* Orders (key, index) pairs by key alone. */
+struct s_byKey {
+    bool    operator()(const std::pair<int, int>& x,
+                       const std::pair<int, int>& y) const {
+        return x.first < y.first;
+    }
+};
+
+int main(void) {
+    constructorsTest();
+    iteratorsTest();
+    lookupTest();
+    copySwapTest();
+    relationalOperatorsTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void constructorsTest(void) {
+    printColor(CYAN, "\n[ CONSTRUCTORS ]\n");
+    t_stdSet            stdS;
+    std::vector<int>    keys = randomKeys(&stdS, g_size);
+
+    printColor(BGWHITE, "\n├─ default constructor\n");
+    t_ftFrozenSet   empty;
+    printStatus(empty.empty() && empty.begin() == empty.end()
+                && empty.find(0) == empty.end());
+
+    printColor(BGWHITE, "\n├─ unsorted range with duplicates\n");
+    t_ftFrozenSet   ftS(keys.begin(), keys.end());
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ from an ft::set and a sorted ft::vector\n");
+    ft::set<int>    set(keys.begin(), keys.end());
+    ft::vector<int> sorted(set.begin(), set.end());
+    t_ftFrozenSet   fromSet(set.begin(), set.end());
+    t_ftFrozenSet   fromVector(sorted.begin(), sorted.end());
+    printStatus(compare_containers(fromSet, stdS, compare<int>)
+                && compare_containers(fromVector, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ the first of equivalent keys is kept\n");
+    std::vector<std::pair<int, int> >       indexed;
+    std::set<std::pair<int, int>, s_byKey>  firsts;
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        indexed.push_back(std::make_pair(keys[i], static_cast<int>(i)));
+        firsts.insert(indexed.back());
+    }
+    ft::frozen_set<std::pair<int, int>, s_byKey>    ftFirsts(indexed.begin(),
+                                                             indexed.end());
+    printStatus(std::equal(firsts.begin(), firsts.end(), ftFirsts.begin())
+                && ftFirsts.size() == firsts.size());
+}
+
+static void iteratorsTest(void) {
+    printColor(CYAN, "\n[ ITERATORS ]\n");
+    t_stdSet            stdS;
+    std::vector<int>    keys = randomKeys(&stdS, g_size);
+    t_ftFrozenSet       ftS(keys.begin(), keys.end());
+    bool                same = true;
+
+    printColor(BGWHITE, "\n├─ reverse iteration\n");
+    t_stdSet::reverse_iterator  stdIt = stdS.rbegin();
+
+    for (t_ftReverseIterator it = ftS.rbegin(); it != ftS.rend();
+            ++it, ++stdIt) {
+        same = same && *it == *stdIt;
+    }
+    printStatus(same && stdIt == stdS.rend());
+
+    printColor(BGWHITE, "\n├─ decrement from end() back to begin()\n");
+    t_ftIterator    it = ftS.end();
+    t_stdIterator   stdLast = stdS.end();
+
+    same = true;
+    while (it != ftS.begin()) {
+        same = same && *--it == *--stdLast;
+    }
+    printStatus(same && stdLast == stdS.begin());
+
+    printColor(BGWHITE, "\n├─ every size up to 64 keeps keys in order\n");
+    for (int size = 1; size <= 64; ++size) {
+        t_ftFrozenSet   small(keys.begin(), keys.begin() + size);
+        t_stdSet        stdSmall(keys.begin(), keys.begin() + size);
+
+        same = same && compare_containers(small, stdSmall, compare<int>);
+    }
+    printStatus(same);
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_stdSet            stdS;
+    std::vector<int>    keys = randomKeys(&stdS, g_size);
+    t_ftFrozenSet       ftS(keys.begin(), keys.end());
+    bool                same = true;
+
+    printColor(BGWHITE, "\n├─ find, count and bounds\n");
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftIterator    lower = ftS.lower_bound(key);
+        t_ftIterator    upper = ftS.upper_bound(key);
+        t_stdIterator   stdLower = stdS.lower_bound(key);
+        t_stdIterator   stdUpper = stdS.upper_bound(key);
+        t_ftIterator    found = ftS.find(key);
+
+        same = same && ftS.count(key) == stdS.count(key)
+                    && (found == ftS.end() ? !stdS.count(key)
+                                           : *found == key)
+                    && (lower == ftS.end() ? stdLower == stdS.end()
+                                           : *lower == *stdLower)
+                    && (upper == ftS.end() ? stdUpper == stdS.end()
+                                           : *upper == *stdUpper);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ equal_range\n");
+    t_ftRange   range = ftS.equal_range(*stdS.begin());
+    t_ftRange   missing = ftS.equal_range(-1);
+    printStatus(range.first == ftS.begin() && ++range.first == range.second
+                && missing.first == missing.second
+                && missing.first == ftS.begin());
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_stdSet            stdS;
+    std::vector<int>    keys = randomKeys(&stdS, g_size);
+    t_ftFrozenSet       ftS(keys.begin(), keys.end());
+    t_ftFrozenSet       copy(ftS);
+    t_ftFrozenSet       other(keys.begin(), keys.begin() + 1);
+
+    printColor(BGWHITE, "\n├─ copy constructor\n");
+    printStatus(compare_containers(copy, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ swap\n");
+    ft::swap(copy, other);
+    printStatus(compare_containers(other, stdS, compare<int>)
+                && copy.size() == 1 && *copy.begin() == keys[0]);
+
+    printColor(BGWHITE, "\n├─ assignment over a non-empty set\n");
+    copy = other;
+    printStatus(compare_containers(copy, stdS, compare<int>));
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_stdSet            stdS;
+    std::vector<int>    keys = randomKeys(&stdS, g_size);
+    t_ftFrozenSet       ftS(keys.begin(), keys.end());
+    t_ftFrozenSet       ftOther(ftS);
+    t_stdSet            stdOther(stdS);
+
+    printStatus(ftS == ftOther && !(ftS < ftOther) && ftS >= ftOther);
+    stdOther.erase(stdOther.begin());
+    ftOther = t_ftFrozenSet(stdOther.begin(), stdOther.end());
+    printStatus((ftS < ftOther) == (stdS < stdOther)
+                && (ftS != ftOther) == (stdS != stdOther)
+                && (ftS > ftOther) == (stdS > stdOther));
+}
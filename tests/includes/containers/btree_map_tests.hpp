@@ -0,0 +1,49 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_BTREE_MAP_TESTS_HPP_
+#define TESTS_INCLUDES_BTREE_MAP_TESTS_HPP_
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../utils.hpp"
+
+/* std has no B-tree: its reference output and times come from std::map. */
+#if STD == 1
+    namespace ft = std;
+    typedef std::map<int, int>                      t_ftBtreeMap;
+    typedef std::map<std::string, int>              t_ftStrBtreeMap;
+#else
+    #include "../../../containers/btree_map.hpp"
+    #include "../../../utility/pair.hpp"
+    typedef ft::btree_map<int, int>                 t_ftBtreeMap;
+    typedef ft::btree_map<std::string, int>         t_ftStrBtreeMap;
+#endif
+
+typedef std::map<int, int>                          t_stdMap;
+typedef t_stdMap::iterator                          t_stdIterator;
+typedef std::map<std::string, int>                  t_stdStrMap;
+
+typedef t_ftBtreeMap::iterator                      t_ftIterator;
+typedef t_ftBtreeMap::const_iterator                t_ftConstIterator;
+typedef t_ftBtreeMap::reverse_iterator              t_ftReverseIterator;
+typedef t_ftBtreeMap::value_type                    t_ftValue;
+typedef ft::pair<int, int>                          t_ftIntPair;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+#if STD != 1
+
+    template <typename Key>
+    bool equal(const ft::pair<const Key, int>& x,
+               const std::pair<const Key, int>& y) {
+        return x.first == y.first && x.second == y.second;
+    }
+
+#endif
+
+void print(const t_ftValue& x) {
+    std::cout << "[" << x.first << ", " << x.second << "] ";
+}
+
+#endif  /* TESTS_INCLUDES_BTREE_MAP_TESTS_HPP_ */
@@ -0,0 +1,57 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_FLAT_MAP_TESTS_HPP_
+#define TESTS_INCLUDES_FLAT_MAP_TESTS_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../utils.hpp"
+
+/* std has no flat_map: its reference output and times come from std::map. */
+#if STD == 1
+    namespace ft = std;
+    typedef std::map<int, int>                      t_ftFlatMap;
+    typedef std::map<std::string, int>              t_ftStrFlatMap;
+#else
+    #include "../../../containers/flat_map.hpp"
+    #include "../../../utility/pair.hpp"
+    typedef ft::flat_map<int, int>                  t_ftFlatMap;
+    typedef ft::flat_map<std::string, int>          t_ftStrFlatMap;
+    typedef ft::flat_map<int, int, std::less<int>,
+                ft::flat_split_storage<int, int> >  t_ftSplitFlatMap;
+#endif
+
+typedef std::map<int, int>                          t_stdMap;
+typedef t_stdMap::iterator                          t_stdIterator;
+typedef std::map<std::string, int>                  t_stdStrMap;
+
+typedef t_ftFlatMap::iterator                       t_ftIterator;
+typedef t_ftFlatMap::const_iterator                 t_ftConstIterator;
+typedef t_ftFlatMap::reverse_iterator               t_ftReverseIterator;
+typedef t_ftFlatMap::value_type                     t_ftValue;
+typedef ft::pair<int, int>                          t_ftIntPair;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+#if STD != 1
+
+    template <typename Key>
+    bool equal(const ft::pair<Key, int>& x,
+               const std::pair<const Key, int>& y) {
+        return x.first == y.first && x.second == y.second;
+    }
+
+    template <typename Key, typename Ref>
+    bool equal(const ft::zip_ref<Key, Ref, int>& x,
+               const std::pair<const Key, int>& y) {
+        return x.first == y.first && x.second == y.second;
+    }
+
+#endif
+
+void print(const t_ftValue& x) {
+    std::cout << "[" << x.first << ", " << x.second << "] ";
+}
+
+#endif  /* TESTS_INCLUDES_FLAT_MAP_TESTS_HPP_ */
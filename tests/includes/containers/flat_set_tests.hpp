@@ -0,0 +1,38 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_FLAT_SET_TESTS_HPP_
+#define TESTS_INCLUDES_FLAT_SET_TESTS_HPP_
+
+#include <set>
+#include <vector>
+
+#include "../utils.hpp"
+
+/* std has no flat_set: its reference output and times come from std::set. */
+#if STD == 1
+    namespace ft = std;
+    typedef std::set<int>                           t_ftFlatSet;
+#else
+    #include "../../../containers/flat_set.hpp"
+    typedef ft::flat_set<int>                       t_ftFlatSet;
+#endif
+
+typedef std::set<int>                               t_stdSet;
+typedef t_stdSet::iterator                          t_stdIterator;
+
+typedef t_ftFlatSet::iterator                       t_ftIterator;
+typedef t_ftFlatSet::const_iterator                 t_ftConstIterator;
+typedef t_ftFlatSet::reverse_iterator               t_ftReverseIterator;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+template <typename T>
+bool compare(T x, T y) {
+    return x == y;
+}
+
+template <typename T>
+void print(T x) {
+    std::cout << x << ' ';
+}
+
+#endif  /* TESTS_INCLUDES_FLAT_SET_TESTS_HPP_ */
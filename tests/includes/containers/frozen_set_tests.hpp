@@ -0,0 +1,39 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_FROZEN_SET_TESTS_HPP_
+#define TESTS_INCLUDES_FROZEN_SET_TESTS_HPP_
+
+#include <set>
+#include <vector>
+
+#include "../utils.hpp"
+
+/* std has no frozen_set: its reference output comes from std::set. */
+#if STD == 1
+    namespace ft = std;
+    typedef std::set<int>                           t_ftFrozenSet;
+#else
+    #include "../../../containers/set.hpp"
+    #include "../../../containers/frozen_set.hpp"
+    typedef ft::frozen_set<int>                     t_ftFrozenSet;
+#endif
+
+typedef std::set<int>                               t_stdSet;
+typedef t_stdSet::iterator                          t_stdIterator;
+
+typedef t_ftFrozenSet::iterator                     t_ftIterator;
+typedef t_ftFrozenSet::const_iterator               t_ftConstIterator;
+typedef t_ftFrozenSet::reverse_iterator             t_ftReverseIterator;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+template <typename T>
+bool compare(T x, T y) {
+    return x == y;
+}
+
+template <typename T>
+void print(T x) {
+    std::cout << x << ' ';
+}
+
+#endif  /* TESTS_INCLUDES_FROZEN_SET_TESTS_HPP_ */
@@ -26,6 +26,9 @@ typedef t_ftStrIntMap::const_iterator           t_ftConstIterator;
 typedef t_ftStrIntMap::reverse_iterator         t_ftReverseIterator;
 typedef t_ftStrIntMap::const_reverse_iterator   t_ftConstReverseIterator;
 
+typedef ft::map<std::string, int, std::less<std::string>,
+    std::allocator<ft::pair<const std::string, int> > > t_ftStdAllocStrIntMap;
+
 typedef ft::pair<std::string, int>              t_ftStrIntPair;
 typedef std::pair<std::string, int>             t_stdStrIntPair;
 
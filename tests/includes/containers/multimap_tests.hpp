@@ -0,0 +1,39 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_MULTIMAP_TESTS_HPP_
+#define TESTS_INCLUDES_MULTIMAP_TESTS_HPP_
+
+#include <map>
+
+#include "../utils.hpp"
+
+#if STD == 1
+    namespace ft = std;
+#else
+    #include "../../../containers/multimap.hpp"
+    #include "../../../utility/pair.hpp"
+#endif
+
+typedef std::multimap<int, int>                     t_stdMultimap;
+typedef t_stdMultimap::iterator                     t_stdIterator;
+
+typedef ft::multimap<int, int>                      t_ftMultimap;
+typedef t_ftMultimap::iterator                      t_ftIterator;
+typedef t_ftMultimap::const_iterator                t_ftConstIterator;
+typedef t_ftMultimap::value_type                    t_ftValue;
+typedef ft::pair<int, int>                          t_ftIntPair;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+#if STD != 1
+
+    bool equal(const t_ftValue& x, const std::pair<const int, int>& y) {
+        return x.first == y.first && x.second == y.second;
+    }
+
+#endif
+
+void print(const t_ftValue& x) {
+    std::cout << "[" << x.first << ", " << x.second << "] ";
+}
+
+#endif  /* TESTS_INCLUDES_MULTIMAP_TESTS_HPP_ */
@@ -0,0 +1,34 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_MULTISET_TESTS_HPP_
+#define TESTS_INCLUDES_MULTISET_TESTS_HPP_
+
+#include <set>
+
+#include "../utils.hpp"
+
+#if STD == 1
+    namespace ft = std;
+#else
+    #include "../../../containers/multiset.hpp"
+#endif
+
+typedef std::multiset<int>                          t_stdMultiset;
+typedef t_stdMultiset::iterator                     t_stdIterator;
+
+typedef ft::multiset<int>                           t_ftMultiset;
+typedef t_ftMultiset::iterator                      t_ftIterator;
+typedef t_ftMultiset::const_iterator                t_ftConstIterator;
+typedef ft::pair<t_ftIterator, t_ftIterator>        t_ftRange;
+
+template <typename T>
+bool compare(T x, T y) {
+    return x == y;
+}
+
+template <typename T>
+void print(T x) {
+    std::cout << x << ' ';
+}
+
+#endif  /* TESTS_INCLUDES_MULTISET_TESTS_HPP_ */
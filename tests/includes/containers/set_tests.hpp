@@ -24,6 +24,8 @@ typedef ft::set<int>::const_iterator                t_ftConstIterator;
 typedef ft::set<int>::reverse_iterator              t_ftReverseIterator;
 typedef ft::set<int>::const_reverse_iterator        t_ftConstReverseIterator;
 
+typedef ft::set<int, std::less<int>, std::allocator<int> > t_ftStdAllocSet;
+
 typedef ft::pair<t_ftIterator, bool>                t_ftPairReturn;
 
 template <typename T>
@@ -0,0 +1,40 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_SMALL_VECTOR_TESTS_HPP_
+#define TESTS_INCLUDES_SMALL_VECTOR_TESTS_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../utils.hpp"
+
+/* std has no small_vector: its reference output comes from std::vector. */
+#if STD == 1
+    #include <stack>
+    namespace ft = std;
+    typedef std::vector<int>                        t_ftSmallVector;
+    typedef std::vector<std::string>                t_ftSmallStringVector;
+#else
+    #include "../../../containers/small_vector.hpp"
+    #include "../../../containers/stack.hpp"
+    typedef ft::small_vector<int, 8>                t_ftSmallVector;
+    typedef ft::small_vector<std::string, 4>        t_ftSmallStringVector;
+#endif
+
+typedef std::vector<int>                            t_stdVector;
+
+typedef t_ftSmallVector::iterator                   t_ftIterator;
+typedef t_ftSmallVector::const_iterator             t_ftConstIterator;
+typedef t_ftSmallVector::reverse_iterator           t_ftReverseIterator;
+
+template <typename T>
+bool compare(T x, T y) {
+    return x == y;
+}
+
+template <typename T>
+void print(T x) {
+    std::cout << x << ' ';
+}
+
+#endif  /* TESTS_INCLUDES_SMALL_VECTOR_TESTS_HPP_ */
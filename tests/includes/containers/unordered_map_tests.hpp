@@ -0,0 +1,83 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_UNORDERED_MAP_TESTS_HPP_
+#define TESTS_INCLUDES_UNORDERED_MAP_TESTS_HPP_
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../utils.hpp"
+
+/**
+ * C++98 has no unordered_map: std::map gives the reference output and
+ * times, and contents are printed in key order on both sides.
+ */
+#if STD == 1
+    namespace ft = std;
+    typedef std::map<std::string, int>              t_ftUnorderedMap;
+    typedef std::map<int, int>                      t_ftIntUnorderedMap;
+#else
+    #include "../../../containers/unordered_map.hpp"
+    #include "../../../utility/pair.hpp"
+    typedef ft::unordered_map<std::string, int>     t_ftUnorderedMap;
+    typedef ft::unordered_map<int, int>             t_ftIntUnorderedMap;
+#endif
+
+typedef std::map<std::string, int>                  t_stdStrMap;
+typedef std::map<int, int>                          t_stdMap;
+typedef t_stdMap::iterator                          t_stdIterator;
+
+typedef t_ftUnorderedMap::iterator                  t_ftIterator;
+typedef t_ftUnorderedMap::const_iterator            t_ftConstIterator;
+typedef t_ftIntUnorderedMap::iterator               t_ftIntIterator;
+typedef ft::pair<std::string, int>                  t_ftStrIntPair;
+
+void print(const t_stdStrMap::value_type& x) {
+    std::cout << "[" << x.first << ", " << x.second << "]";
+}
+
+template <typename Map>
+void printSorted(const Map& m) {
+    t_stdStrMap sorted;
+
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+        sorted.insert(std::make_pair(it->first, it->second));
+    }
+    printContainer(sorted, print);
+}
+
+/* Whether ftM holds the same key and value pairs as stdM. */
+template <typename Map, typename StdMap>
+bool sameElements(const Map& ftM, const StdMap& stdM) {
+    if (ftM.size() != stdM.size()) {
+        return false;
+    }
+    for (typename StdMap::const_iterator it = stdM.begin();
+            it != stdM.end(); ++it) {
+        typename Map::const_iterator    found = ftM.find(it->first);
+
+        if (found == ftM.end() || found->second != it->second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Keys "0" to "size - 1" in shuffled order, with random values. */
+t_ftStrIntPair* createPairs(std::size_t size) {
+    t_ftStrIntPair*     pairs = new t_ftStrIntPair[size];
+    int*                keys = createArray(size);
+    std::stringstream   ss;
+
+    srand(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        ss.clear();
+        ss << keys[i] << ' ', ss >> pairs[i].first;
+        pairs[i].second = rand() % size;
+    }
+    delete[] keys;
+    return pairs;
+}
+
+#endif  /* TESTS_INCLUDES_UNORDERED_MAP_TESTS_HPP_ */
@@ -0,0 +1,53 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef TESTS_INCLUDES_UNORDERED_SET_TESTS_HPP_
+#define TESTS_INCLUDES_UNORDERED_SET_TESTS_HPP_
+
+#include <set>
+
+#include "../utils.hpp"
+
+/**
+ * C++98 has no unordered_set: std::set gives the reference output and
+ * times, and contents are printed in key order on both sides.
+ */
+#if STD == 1
+    namespace ft = std;
+    typedef std::set<int>                           t_ftUnorderedSet;
+#else
+    #include "../../../containers/unordered_set.hpp"
+    typedef ft::unordered_set<int>                  t_ftUnorderedSet;
+#endif
+
+typedef std::set<int>                               t_stdSet;
+typedef t_stdSet::iterator                          t_stdIterator;
+
+typedef t_ftUnorderedSet::iterator                  t_ftIterator;
+typedef t_ftUnorderedSet::const_iterator            t_ftConstIterator;
+
+void print(int x) {
+    std::cout << x << ' ';
+}
+
+template <typename Set>
+void printSorted(const Set& s) {
+    t_stdSet    sorted(s.begin(), s.end());
+
+    printContainer(sorted, print);
+}
+
+/* Whether ftS holds the same keys as stdS. */
+template <typename Set>
+bool sameElements(const Set& ftS, const t_stdSet& stdS) {
+    if (ftS.size() != stdS.size()) {
+        return false;
+    }
+    for (t_stdIterator it = stdS.begin(); it != stdS.end(); ++it) {
+        if (ftS.find(*it) == ftS.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif  /* TESTS_INCLUDES_UNORDERED_SET_TESTS_HPP_ */
@@ -17,6 +17,27 @@
     typedef std::vector<int>::reverse_iterator          t_stdReverseIterator;
     typedef std::vector<int>::const_reverse_iterator    t_stdConstReverseIterator;
 
+    /* Owns heap memory, counts its copies and opts in to relocation. */
+    struct t_buffer {
+        static int  copies;
+        int*        value;
+
+        explicit t_buffer(int n = 0) : value(new int(n)) {}
+        t_buffer(const t_buffer& src) : value(new int(*src.value)) {
+            ++copies;
+        }
+        ~t_buffer() { delete value; }
+
+        t_buffer&   operator=(const t_buffer& rhs) {
+            *value = *rhs.value;
+            return *this;
+        }
+    };
+
+    namespace ft {
+    template <> struct is_trivially_relocatable<t_buffer> : true_type {};
+    }
+
 #endif
 
 typedef ft::vector<int>::iterator                   t_ftIterator;
@@ -41,6 +62,7 @@ typedef ft::vector<int>::const_reverse_iterator     t_ftConstReverseIterator;
 
 #define EXCEPT_MSG_06 "Error: assign() should have thrown an exception\n"
 #define EXCEPT_MSG_07 "Error: resize() should have thrown an exception\n"
+#define EXCEPT_MSG_08 "Error: a debug check should have failed\n"
 
 template <typename Container>
 static void accessorTestAux1(Container& c, long n) {
@@ -53,6 +75,7 @@ static void accessorTestAux1(Container& c, long n) {
     }
 }
 
+/* operator[] is only checked with FT_DEBUG. */
 template <typename Container>
 static void accessorTestAux2(Container& c, long n) {
     try {
@@ -64,6 +87,19 @@ static void accessorTestAux2(Container& c, long n) {
     }
 }
 
+/* Only with FT_DEBUG, where an invalid iterator fails a check. */
+template <typename Container>
+static void eraseCheckTestAux(Container& c,
+                              typename Container::iterator pos) {
+    try {
+        c.erase(pos);
+        std::cerr << EXCEPT_MSG_08;
+        printStatus(false);
+    } catch (const std::logic_error& e) {
+        printStatus(true);
+    }
+}
+
 template <typename T>
 bool compare(T x, T y) {
     return x == y;
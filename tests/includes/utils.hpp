@@ -22,6 +22,15 @@
     #define AMOUNT 10000
 #endif
 
+/* Opt-in benchmarks growing containers to a few GB: make vector4. */
+#if BIG_TEST != 1
+    #define BIG_TEST 0
+#endif
+
+#ifndef BIG_AMOUNT
+    #define BIG_AMOUNT (1UL << 29)
+#endif
+
 #define OK      "├── \x1b[32mOK\x1b[0m\n"
 #define KO      "├── \x1b[31mKO\x1b[0m\n"
 #define CYAN    "\033[1;36m"
@@ -9,6 +9,7 @@ static void operationsTest(void);
 static void insertTest(void);
 static void eraseTest(void);
 static void swapTest(void);
+static void allocatorTest(void);
 
 const s_create_pairs  g_pairs(AMOUNT);
 const s_pairs         g_pair_begin(g_pairs.begin());
@@ -22,6 +23,7 @@ int main(void) {
     insertTest();
     eraseTest();
     swapTest();
+    allocatorTest();
     printTime(RESULT);
     return 0;
 }
@@ -374,5 +376,53 @@ static void insertTest(void) {
         m.insert(m.begin(), m.end());
         printContainer(m, print);
     }
+    {
+        std::cout << "\n\ninsert with hint (ascending keys at end())\n";
+        const t_ftStrIntMap sorted(g_pair_begin.ft, g_pair_end.ft);
+        t_ftStrIntMap       m;
+
+        for (t_ftConstIterator it = sorted.begin(); it != sorted.end(); ++it) {
+            m.insert(m.end(), *it);
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (descending keys at begin())\n";
+        m.clear();
+        for (t_ftConstIterator it = sorted.end(); it != sorted.begin();) {
+            m.insert(m.begin(), *--it);
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (unsorted keys at end())\n";
+        m.clear();
+        for (std::size_t i = 0; i < g_pairs.size; ++i) {
+            m.insert(m.end(), g_pair_begin.ft[i]);
+        }
+        printContainer(m, print);
+    }
+    printTime(1);
+}
+
+template <typename Map>
+static void allocatorWorkload(void) {
+    Map m(g_pair_begin.ft, g_pair_end.ft);
+
+    for (std::size_t i = 0; i < g_pairs.size; i += 2) {
+        m.erase(g_pair_begin.ft[i].first);
+    }
+    m.insert(g_pair_begin.ft, g_pair_end.ft);
+    printContainer(m, print);
+    m.clear();
+}
+
+static void allocatorTest(void) {
+    std::cout << "\n[ ALLOCATOR (default) ]\n";
+    printTime(0);
+    allocatorWorkload<t_ftStrIntMap>();
+    printTime(1);
+
+    std::cout << "\n[ ALLOCATOR (std::allocator) ]\n";
+    printTime(0);
+    allocatorWorkload<t_ftStdAllocStrIntMap>();
     printTime(1);
 }
@@ -5,6 +5,14 @@
 static void algorithmsTest(void);
 static void accessorsTest(void);
 static void iteratorTest(void);
+static void insertTest(void);
+static void assignmentTest(void);
+static void lookupTest(void);
+static void orderStatisticsTest(void);
+static void aggregateTest(void);
+static void splitMergeTest(void);
+static void nodeHandleTest(void);
+static void setAlgebraTest(void);
 static void clearTest(void);
 static void sizeTest(void);
 
@@ -16,6 +24,14 @@ int main(void) {
     algorithmsTest();
     accessorsTest();
     iteratorTest();
+    insertTest();
+    assignmentTest();
+    lookupTest();
+    orderStatisticsTest();
+    aggregateTest();
+    splitMergeTest();
+    nodeHandleTest();
+    setAlgebraTest();
     clearTest();
     sizeTest();
     printStatus(RESULT);
@@ -247,3 +263,446 @@ static void accessorsTest(void) {
     ftM.at(g_pair_begin.ft[4].first) = g_pair_begin.ft[12].second;
     printStatus(ftM.at(g_pair_begin.ft[4].first) != stdM.at(g_pair_begin.std[4].first));
 }
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftStrIntMap   ftM;
+    t_stdStrIntMap  stdM;
+
+    for (std::size_t i = 0; i < g_pairs.size; ++i) {
+        ftM.insert(g_pair_begin.ft[i]);
+        stdM.insert(g_pair_begin.std[i]);
+    }
+
+    printColor(BGWHITE, "\n├─ insert (new key)\n");
+    t_ftPairReturn  ftRet = ftM.insert(t_ftStrIntPair("new", 1));
+    printStatus(ftRet.second && ftRet.first->first == "new");
+    printStatus(ftM.size() == stdM.size() + 1);
+    ftM.erase("new");
+
+    printColor(BGWHITE, "\n├─ insert (existing key)\n");
+    ftRet = ftM.insert(t_ftStrIntPair(g_pair_begin.ft[3].first, -1));
+    printStatus(!ftRet.second);
+    printStatus(equal()(*ftRet.first, *stdM.find(g_pair_begin.std[3].first)));
+    printStatus(compare_containers(ftM, stdM, equal()));
+
+    printColor(BGWHITE, "\n├─ insert range (sorted, into empty map)\n");
+    {
+        t_ftStrIntMap   sortedM(ftM.begin(), ftM.end());
+        sortedM.insert(ftM.begin(), ftM.end());
+        printStatus(compare_containers(sortedM, stdM, equal()));
+
+    }
+
+    printColor(BGWHITE, "\n├─ insert range (sorted prefix, unsorted tail)\n");
+    {
+        t_ftStrIntMap   prefixM;
+        prefixM.insert(g_pair_begin.ft, g_pair_end.ft);
+        printStatus(compare_containers(prefixM, stdM, equal()));
+    }
+
+    printColor(BGWHITE, "\n├─ operator[] (existing key)\n");
+    printStatus(ftM[g_pair_begin.ft[7].first] == stdM[g_pair_begin.std[7].first]);
+    printStatus(ftM.size() == stdM.size());
+}
+
+std::size_t g_allocations = 0;
+
+/* std::allocator that counts its allocations in g_allocations. */
+template <typename T>
+struct s_counting_allocator : public std::allocator<T> {
+    template <typename U>
+    struct rebind { typedef s_counting_allocator<U> other; };
+
+    s_counting_allocator() {}
+    s_counting_allocator(const s_counting_allocator& src)
+        : std::allocator<T>(src) {}
+    template <typename U>
+    s_counting_allocator(const s_counting_allocator<U>&) {}
+
+    T*  allocate(std::size_t n, const void* = 0) {
+        ++g_allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+static void assignmentTest(void) {
+    printColor(CYAN, "\n[ COPY AND ASSIGNMENT ]\n");
+    typedef ft::map<std::string, int, std::less<std::string>,
+                    s_counting_allocator<ft::pair<const std::string, int> > >
+                                                        t_countedMap;
+    t_countedMap    big(g_pair_begin.ft, g_pair_end.ft);
+    t_countedMap    small(g_pair_begin.ft, g_pair_begin.ft + 5);
+    t_stdStrIntMap  stdBig(g_pair_begin.std, g_pair_end.std);
+    t_stdStrIntMap  stdSmall(g_pair_begin.std, g_pair_begin.std + 5);
+
+    printColor(BGWHITE, "\n├─ the copy keeps the source's allocator\n");
+    t_ftStrIntMap   pooled;
+    t_ftStrIntMap   copy(pooled);
+    printStatus(copy.get_allocator() == pooled.get_allocator()
+                && copy.get_allocator() != t_ftStrIntMap().get_allocator());
+
+    printColor(BGWHITE, "\n├─ assigning a smaller map reuses nodes\n");
+    t_countedMap    target(big);
+
+    g_allocations = 0;
+    target = small;
+    printStatus(g_allocations == 0
+                && compare_containers(target, stdSmall, equal()));
+
+    printColor(BGWHITE, "\n├─ assigning a larger map allocates the rest\n");
+    g_allocations = 0;
+    target = big;
+    printStatus(g_allocations == big.size() - small.size()
+                && compare_containers(target, stdBig, equal()));
+}
+
+/* Mapped type that counts how many times it was ever constructed. */
+struct s_counted {
+    static std::size_t  constructions;
+
+    s_counted() { ++constructions; }
+    s_counted(const s_counted&) { ++constructions; }
+};
+
+std::size_t s_counted::constructions = 0;
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    ft::map<int, s_counted> countedM;
+
+    for (int i = 0; i < 10; ++i) {
+        countedM[i];
+    }
+
+    printColor(BGWHITE, "\n├─ lookups by key build no mapped_type\n");
+    std::size_t constructions = s_counted::constructions;
+    countedM.find(3);
+    countedM.count(11);
+    countedM.lower_bound(4);
+    countedM.upper_bound(4);
+    countedM.equal_range(5);
+    countedM.erase(6);
+    printStatus(s_counted::constructions == constructions);
+    printStatus(countedM.size() == 9 && countedM.count(6) == 0);
+
+    printColor(BGWHITE, "\n├─ transparent comparator (const char* keys)\n");
+    ft::map<std::string, int, ft::transparent_less> ftM;
+    t_stdStrIntMap                                  stdM;
+
+    for (std::size_t i = 0; i < g_pairs.size; ++i) {
+        ftM.insert(g_pair_begin.ft[i]);
+        stdM.insert(g_pair_begin.std[i]);
+    }
+    printStatus(ftM.find("7") != ftM.end() && ftM.find("7")->second
+                                              == stdM.find("7")->second);
+    printStatus(ftM.find("70") == ftM.end());
+    printStatus(ftM.count("12") == 1 && ftM.count("") == 0);
+    printStatus(ftM.lower_bound("11")->first == stdM.lower_bound("11")->first);
+    printStatus(ftM.upper_bound("11")->first == stdM.upper_bound("11")->first);
+    printStatus(ftM.equal_range("3").first->first == "3"
+                && ftM.equal_range("3").second->first == "4");
+}
+
+static void orderStatisticsTest(void) {
+    printColor(CYAN, "\n[ ORDER STATISTICS ]\n");
+    typedef ft::map<std::string, int, std::less<std::string>,
+                    ft::pool_allocator<ft::pair<const std::string, int> >,
+                    ft::order_statistics_update>    t_ftRankedMap;
+    t_ftRankedMap   ftM(g_pair_begin.ft, g_pair_end.ft);
+    t_stdStrIntMap  stdM(g_pair_begin.std, g_pair_end.std);
+    bool            same = true;
+    std::size_t     k = 0;
+
+    printColor(BGWHITE, "\n├─ nth(k), rank(key) and distance()\n");
+    for (t_stdIterator it = stdM.begin(); it != stdM.end(); ++it, ++k) {
+        same = same && ftM.nth(k)->first == it->first
+                    && ftM.rank(it->first) == k
+                    && ftM.distance(ftM.begin(), ftM.find(it->first))
+                       == static_cast<long>(k);
+    }
+    printStatus(same);
+    printStatus(ftM.nth(ftM.size()) == ftM.end());
+
+    printColor(BGWHITE, "\n├─ rank(key) of a missing key\n");
+    printStatus(ftM.rank("10a") == static_cast<std::size_t>(
+                    std::distance(stdM.begin(), stdM.lower_bound("10a"))));
+}
+
+template <typename Map>
+static bool aggregateMatches(const Map& ftM, const std::map<int, long>& stdM,
+                             int lo, int hi) {
+    long    sum = 0;
+    long    max = std::numeric_limits<long>::min();
+
+    for (std::map<int, long>::const_iterator it = stdM.lower_bound(lo);
+         it != stdM.end() && it->first < hi; ++it) {
+        sum += it->second;
+        max = std::max(max, it->second);
+    }
+    return ftM.first.aggregate(lo, hi) == sum
+        && ftM.second.aggregate(lo, hi) == max;
+}
+
+static void aggregateTest(void) {
+    printColor(CYAN, "\n[ AGGREGATE ]\n");
+    typedef ft::pool_allocator<ft::pair<const int, long> >  t_alloc;
+    typedef ft::map<int, long, std::less<int>, t_alloc,
+                    ft::aggregate_update<ft::sum_monoid<long> > >   t_sumMap;
+    typedef ft::map<int, long, std::less<int>, t_alloc,
+                    ft::aggregate_update<ft::max_monoid<long> > >   t_maxMap;
+    std::pair<t_sumMap, t_maxMap>   ftM;
+    std::map<int, long>             stdM;
+    bool                            same = true;
+
+    srand(42);
+    for (int i = 0; i < 200; ++i) {
+        int     key = rand() % 500;
+        long    value = rand() % 1000 - 500;
+
+        ftM.first.insert(ft::make_pair(key, value));
+        ftM.second.insert(ft::make_pair(key, value));
+        stdM.insert(std::make_pair(key, value));
+    }
+
+    printColor(BGWHITE, "\n├─ sum and max over [lo, hi)\n");
+    for (int lo = -10; lo < 510; lo += 7) {
+        same = same && aggregateMatches(ftM, stdM, lo, lo + 60)
+                    && aggregateMatches(ftM, stdM, lo, 510);
+    }
+    printStatus(same);
+    printStatus(aggregateMatches(ftM, stdM, 200, 100));
+
+    printColor(BGWHITE, "\n├─ after erase\n");
+    for (int key = 0; key < 500; key += 3) {
+        ftM.first.erase(key);
+        ftM.second.erase(key);
+        stdM.erase(key);
+    }
+    ftM.first.erase(ftM.first.lower_bound(100), ftM.first.lower_bound(300));
+    ftM.second.erase(ftM.second.lower_bound(100),
+                     ftM.second.lower_bound(300));
+    stdM.erase(stdM.lower_bound(100), stdM.lower_bound(300));
+    same = true;
+    for (int lo = -10; lo < 510; lo += 7) {
+        same = same && aggregateMatches(ftM, stdM, lo, lo + 60);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ max of negative doubles\n");
+    typedef ft::map<int, double, std::less<int>,
+                    ft::pool_allocator<ft::pair<const int, double> >,
+                    ft::aggregate_update<ft::max_monoid<double> > >
+                                                            t_maxDoubleMap;
+    t_maxDoubleMap  negative;
+
+    for (int i = 1; i <= 50; ++i) {
+        negative.insert(ft::make_pair(i, -1.5 * i));
+    }
+    printStatus(negative.aggregate(0, 100) == -1.5
+                && negative.aggregate(10, 20) == -15.0
+                && negative.aggregate(60, 70)
+                   == -std::numeric_limits<double>::infinity());
+
+    printColor(BGWHITE, "\n├─ after update(it, value)\n");
+    for (std::map<int, long>::iterator it = stdM.begin(); it != stdM.end();
+         ++it) {
+        it->second = it->first % 7 - 3;
+        ftM.first.update(ftM.first.find(it->first), it->second);
+        ftM.second.update(ftM.second.find(it->first), it->second);
+    }
+    same = true;
+    for (int lo = -10; lo < 510; lo += 7) {
+        same = same && aggregateMatches(ftM, stdM, lo, lo + 60);
+    }
+    printStatus(same && ftM.first[stdM.begin()->first]
+                        == stdM.begin()->second);
+}
+
+static void splitMergeTest(void) {
+    printColor(CYAN, "\n[ SPLIT AND MERGE ]\n");
+    t_ftStrIntMap   ftM(g_pair_begin.ft, g_pair_end.ft);
+    t_stdStrIntMap  stdM(g_pair_begin.std, g_pair_end.std);
+    t_stdIterator   cut = stdM.begin();
+
+    std::advance(cut, stdM.size() / 2);
+    const std::string   key = cut->first;
+    t_ftStrIntMap       ftTail;
+    t_stdStrIntMap      stdTail(cut, stdM.end());
+
+    printColor(BGWHITE, "\n├─ split_off(key)\n");
+    ftM.split_off(key, ftTail);
+    stdM.erase(cut, stdM.end());
+    printStatus(compare_containers(ftM, stdM, equal()));
+    printStatus(compare_containers(ftTail, stdTail, equal()));
+
+    printColor(BGWHITE, "\n├─ merge (disjoint)\n");
+    ftTail.merge(ftM);
+    stdTail.insert(stdM.begin(), stdM.end());
+    printStatus(ftM.empty() && compare_containers(ftTail, stdTail, equal()));
+
+    printColor(BGWHITE, "\n├─ only shared_pool allocators share a pool\n");
+    typedef t_ftStrIntMap::allocator_type   t_alloc;
+    t_ftStrIntMap   ftOther;
+
+    printStatus(t_alloc(ft::shared_pool) == t_alloc(ft::shared_pool)
+                && t_alloc(ft::shared_pool) != t_alloc()
+                && ftOther.get_allocator() != ftM.get_allocator());
+
+    printColor(BGWHITE, "\n├─ merge (overlapping, other allocator)\n");
+
+    ftOther.insert(t_ftStrIntPair(key, -1));
+    ftOther.insert(t_ftStrIntPair("~", 1));
+    ftTail.merge(ftOther);
+    stdTail.insert(t_stdStrIntPair("~", 1));
+    printStatus(ftOther.size() == 1 && ftOther.begin()->second == -1
+                && compare_containers(ftTail, stdTail, equal()));
+
+    printColor(BGWHITE, "\n├─ aggregate after split_off and merge\n");
+    typedef ft::map<int, long, std::less<int>,
+                    ft::pool_allocator<ft::pair<const int, long> >,
+                    ft::aggregate_update<ft::sum_monoid<long> > >   t_sumMap;
+    t_sumMap    low;
+
+    for (int i = 0; i < 300; ++i) {
+        low.insert(ft::make_pair(i, static_cast<long>(i)));
+    }
+    t_sumMap    high;
+
+    low.split_off(100, high);
+    printStatus(low.size() == 100 && low.aggregate(0, 300) == 4950
+                && high.size() == 200 && high.aggregate(0, 300) == 39900);
+    low.merge(high);
+    printStatus(high.empty() && low.size() == 300
+                && low.aggregate(50, 150) == 9950);
+
+    printColor(BGWHITE, "\n├─ split_off between shared maps: no copy\n");
+    typedef ft::map<int, s_counted>     t_countedMap;
+    const t_countedMap::allocator_type  pool(ft::shared_pool);
+    t_countedMap    counted(std::less<int>(), pool);
+    t_countedMap    emptyDest(std::less<int>(), pool);
+    t_countedMap    fullDest(std::less<int>(), pool);
+
+    for (int i = 0; i < 1000; ++i) {
+        counted.insert(ft::make_pair(i, s_counted()));
+    }
+    fullDest.insert(ft::make_pair(2000, s_counted()));
+    std::size_t constructions = s_counted::constructions;
+    std::size_t header;
+
+    counted.split_off(500, emptyDest);
+    printStatus(s_counted::constructions == constructions
+                && counted.size() == 500 && emptyDest.size() == 500);
+    {
+        /* A non-empty dest takes a temporary map, whose header has a value. */
+        t_countedMap    probe;
+
+        header = s_counted::constructions - constructions;
+    }
+    constructions = s_counted::constructions;
+    counted.split_off(250, fullDest);
+    printStatus(s_counted::constructions - constructions == header
+                && counted.size() == 250 && fullDest.size() == 251
+                && fullDest.begin()->first == 250);
+}
+
+static void nodeHandleTest(void) {
+    printColor(CYAN, "\n[ NODE HANDLES ]\n");
+    typedef t_ftStrIntMap::node_type    t_node;
+    t_ftStrIntMap   ftM(g_pair_begin.ft, g_pair_end.ft);
+    t_stdStrIntMap  stdM(g_pair_begin.std, g_pair_end.std);
+    const std::string   key = g_pair_begin.std[4].first;
+
+    printColor(BGWHITE, "\n├─ extract(key) and rekeyed insert\n");
+    t_node                                  node = ftM.extract(key);
+    const t_ftStrIntMap::value_type*        address = &node.value();
+
+    printStatus(!node.empty() && node.mapped() == stdM[key]
+                && ftM.size() == stdM.size() - 1 && ftM.count(key) == 0);
+    node.key() = "rekeyed";
+    stdM["rekeyed"] = stdM[key];
+    stdM.erase(key);
+    ft::pair<t_ftIterator, bool>    ret = ftM.insert(node);
+    printStatus(ret.second && node.empty() && &*ret.first == address
+                && compare_containers(ftM, stdM, equal()));
+
+    printColor(BGWHITE, "\n├─ insert of a duplicate keeps the node\n");
+    node = ftM.extract(ftM.begin());
+    address = &node.value();
+    ftM.insert(t_ftStrIntPair(node.key(), -1));
+    ret = ftM.insert(node);
+    printStatus(!ret.second && !node.empty() && &node.value() == address
+                && ret.first->second == -1);
+
+    printColor(BGWHITE, "\n├─ moving nodes between maps\n");
+    t_ftStrIntMap   shared(ftM.key_comp(), ftM.get_allocator());
+    t_ftStrIntMap   other;
+
+    node = ftM.extract("rekeyed");
+    address = &node.value();
+    shared.insert(shared.end(), node);
+    node = ftM.extract(ftM.begin());
+    other.insert(node);
+    printStatus(&*shared.begin() == address && node.empty()
+                && other.size() == 1 && ftM.size() == stdM.size() - 2);
+
+    printColor(BGWHITE, "\n├─ extract of a missing key\n");
+    node = ftM.extract("missing");
+    printStatus(node.empty() && ftM.insert(node).first == ftM.end());
+
+    printColor(BGWHITE, "\n├─ no copy between shared maps\n");
+    typedef ft::map<int, s_counted>     t_countedMap;
+    const t_countedMap::allocator_type  pool(ft::shared_pool);
+    t_countedMap                        from(std::less<int>(), pool);
+    t_countedMap                        to(std::less<int>(), pool);
+    t_countedMap::node_type             moved;
+
+    for (int i = 0; i < 10; ++i) {
+        from.insert(ft::make_pair(i, s_counted()));
+    }
+    std::size_t constructions = s_counted::constructions;
+
+    moved = from.extract(4);
+    const s_counted*    mapped = &moved.mapped();
+    to.insert(moved);
+    moved = from.extract(from.begin());
+    to.insert(to.begin(), moved);
+    printStatus(s_counted::constructions == constructions && moved.empty()
+                && &to.find(4)->second == mapped && to.size() == 2
+                && from.size() == 8);
+}
+
+static void setAlgebraTest(void) {
+    printColor(CYAN, "\n[ SET ALGEBRA ]\n");
+    t_ftStrIntMap   ftOther;
+    t_stdStrIntMap  stdOther;
+
+    for (std::size_t i = 5; i < g_pairs.size; ++i) {
+        ftOther.insert(t_ftStrIntPair(g_pair_begin.ft[i].first, -1));
+        stdOther.insert(t_stdStrIntPair(g_pair_begin.std[i].first, -1));
+    }
+    t_ftStrIntMap   ftM(g_pair_begin.ft, g_pair_begin.ft + 10);
+    t_stdStrIntMap  stdM(g_pair_begin.std, g_pair_begin.std + 10);
+    t_stdStrIntMap  stdU(stdM);
+    t_stdStrIntMap  stdI;
+    t_stdStrIntMap  stdD;
+
+    stdU.insert(stdOther.begin(), stdOther.end());
+    for (t_stdIterator it = stdM.begin(); it != stdM.end(); ++it) {
+        (stdOther.count(it->first) ? stdI : stdD).insert(*it);
+    }
+
+    printColor(BGWHITE, "\n├─ unite() keeps the values already here\n");
+    t_ftStrIntMap   ftU(ftM);
+    ftU.unite(ftOther);
+    printStatus(compare_containers(ftU, stdU, equal()));
+
+    printColor(BGWHITE, "\n├─ intersect() and subtract()\n");
+    t_ftStrIntMap   ftI(ftM);
+    t_ftStrIntMap   ftD(ftM);
+    ftI.intersect(ftOther);
+    ftD.subtract(ftOther);
+    printStatus(compare_containers(ftI, stdI, equal()));
+    printStatus(compare_containers(ftD, stdD, equal()));
+    printStatus(compare_containers(ftOther, stdOther, equal()));
+}
@@ -0,0 +1,133 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/multimap_tests.hpp"
+
+static void constructorsTest(void);
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    insertTest();
+    lookupTest();
+    eraseTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+/* The i-th element: keys repeat, values tell equal keys apart. */
+static t_ftIntPair element(int i) {
+    return ft::make_pair(g_array[i] % (g_array_size / 3 + 1), i);
+}
+
+static void fill(t_ftMultimap* m) {
+    for (int i = 0; i < g_array_size; ++i) {
+        m->insert(element(i));
+    }
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftMultimap    m1;
+
+        fill(&m1);
+
+        t_ftMultimap    m2(m1.begin(), m1.end());
+
+        printContainer(m2, print);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftMultimap    m1;
+
+        fill(&m1);
+
+        t_ftMultimap    m2(m1);
+        t_ftMultimap    m3;
+
+        m3 = m2;
+        printContainer(m2, print);
+        printContainer(m3, print);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\ninsert single elements\n";
+        t_ftMultimap    m;
+
+        fill(&m);
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\ninsert with hint (at end())\n";
+        t_ftMultimap    m;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.end(), element(i));
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (at begin())\n";
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.begin(), element(i));
+        }
+        printContainer(m, print);
+
+        std::cout << "\n\ninsert with hint (at find())\n";
+        for (int i = 0; i < g_array_size; ++i) {
+            m.insert(m.find(element(i).first + 1), element(i));
+        }
+        printContainer(m, print);
+    }
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    t_ftMultimap    m;
+
+    fill(&m);
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = -1; i <= g_array_size / 3 + 1; ++i) {
+        std::cout << "count(" << i << "): " << m.count(i) << " values:";
+        for (t_ftRange r = m.equal_range(i); r.first != r.second; ++r.first) {
+            std::cout << ' ' << r.first->second;
+        }
+        std::cout << '\n';
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    t_ftMultimap    m;
+
+    fill(&m);
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nerase(key)\n";
+        for (int i = 0; i < g_array_size / 3; i += 2) {
+            std::cout << m.erase(i) << ' ';
+        }
+        std::cout << '\n';
+        printContainer(m, print);
+    }
+    {
+        std::cout << "\n\nerase(first, last)\n";
+        m.erase(m.begin(), m.upper_bound(g_array_size / 6));
+        printContainer(m, print);
+    }
+    printTime(1);
+}
@@ -0,0 +1,99 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/multimap_tests.hpp"
+
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+
+static void fill(t_ftMultimap* ftM, t_stdMultimap* stdM) {
+    int keys[] = { 5, 3, 5, 1, 3, 5, 8, 1, 9, 5 };
+
+    for (int i = 0; i < 10; ++i) {
+        ftM->insert(ft::make_pair(keys[i], i));
+        stdM->insert(std::make_pair(keys[i], i));
+    }
+}
+
+int main(void) {
+    insertTest();
+    lookupTest();
+    eraseTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftMultimap        ftM;
+    t_stdMultimap       stdM;
+
+    printColor(BGWHITE, "\n├─ insert (equal keys keep insertion order)\n");
+    fill(&ftM, &stdM);
+    printStatus(compare_containers(ftM, stdM, equal));
+    t_ftIterator    it = ftM.insert(ft::make_pair(5, 10));
+    stdM.insert(std::make_pair(5, 10));
+    printStatus(it->first == 5 && it->second == 10 && ++it == ftM.find(8));
+
+    printColor(BGWHITE, "\n├─ insert range\n");
+    {
+        t_ftMultimap    rangeM(ftM.begin(), ftM.end());
+        printStatus(compare_containers(rangeM, stdM, equal));
+    }
+
+    printColor(BGWHITE, "\n├─ insert with hint\n");
+    ftM.insert(ftM.find(5), ft::make_pair(5, 11));
+    stdM.insert(stdM.find(5), std::make_pair(5, 11));
+    ftM.insert(ftM.find(3), ft::make_pair(5, 12));
+    stdM.insert(stdM.find(3), std::make_pair(5, 12));
+    ftM.insert(ftM.begin(), ft::make_pair(3, 13));
+    stdM.insert(stdM.begin(), std::make_pair(3, 13));
+    ftM.insert(ftM.end(), ft::make_pair(9, 14));
+    stdM.insert(stdM.end(), std::make_pair(9, 14));
+    printStatus(compare_containers(ftM, stdM, equal));
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_ftMultimap        ftM;
+    t_stdMultimap       stdM;
+    bool                same = true;
+
+    fill(&ftM, &stdM);
+    printColor(BGWHITE, "\n├─ count and equal_range\n");
+    for (int key = 0; key < 11; ++key) {
+        t_ftRange                                   ftRange
+                                                    = ftM.equal_range(key);
+        std::pair<t_stdIterator, t_stdIterator>     stdRange
+                                                    = stdM.equal_range(key);
+
+        same = same && ftM.count(key) == stdM.count(key)
+                    && ftRange.first == ftM.lower_bound(key)
+                    && ftRange.second == ftM.upper_bound(key);
+        for (; stdRange.first != stdRange.second; ++stdRange.first) {
+            same = same && equal(*ftRange.first++, *stdRange.first);
+        }
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ find (first of the equal keys)\n");
+    printStatus(ftM.find(5)->second == 0 && ftM.find(4) == ftM.end());
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    t_ftMultimap        ftM;
+    t_stdMultimap       stdM;
+
+    fill(&ftM, &stdM);
+    printColor(BGWHITE, "\n├─ erase(key) returns the number erased\n");
+    printStatus(ftM.erase(5) == 4 && ftM.erase(5) == 0);
+    stdM.erase(5);
+    printStatus(compare_containers(ftM, stdM, equal));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) over an equal range\n");
+    t_ftRange       range = ftM.equal_range(1);
+    ftM.erase(range.first, range.second);
+    stdM.erase(1);
+    printStatus(compare_containers(ftM, stdM, equal));
+}
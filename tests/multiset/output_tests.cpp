@@ -0,0 +1,142 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/multiset_tests.hpp"
+
+static void constructorsTest(void);
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    insertTest();
+    lookupTest();
+    eraseTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+/* Each value of g_array, folded so that every key shows up a few times. */
+static int key(int i) {
+    return g_array[i] % (g_array_size / 3 + 1);
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        ft::multiset<int>   s(g_array, g_array + g_array_size);
+
+        s.insert(g_array, g_array + g_array_size);
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        ft::multiset<int>   s1(g_array, g_array + g_array_size);
+
+        s1.insert(g_array, g_array + g_array_size / 2);
+
+        ft::multiset<int>   s2(s1);
+        ft::multiset<int>   s3;
+
+        s3 = s2;
+        printContainer(s2, print<int>);
+        printContainer(s3, print<int>);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\ninsert single elements\n";
+        ft::multiset<int>   s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(key(i));
+        }
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\ninsert with hint (ascending values at end())\n";
+        ft::multiset<int>   s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(s.end(), i / 2);
+        }
+        printContainer(s, print<int>);
+
+        std::cout << "\n\ninsert with hint (unsorted values at begin())\n";
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(s.begin(), key(i));
+        }
+        printContainer(s, print<int>);
+    }
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    ft::multiset<int>   s;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        s.insert(key(i));
+    }
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = -1; i <= g_array_size / 3 + 1; ++i) {
+        std::cout << "count(" << i << "): " << s.count(i)
+                  << " equal_range: "
+                  << std::distance(s.equal_range(i).first,
+                                   s.equal_range(i).second)
+                  << " lower_bound: " << std::distance(s.begin(),
+                                                       s.lower_bound(i))
+                  << '\n';
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    ft::multiset<int>   s;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        s.insert(key(i));
+    }
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nerase(key)\n";
+        for (int i = 0; i < g_array_size / 3; i += 2) {
+            std::cout << s.erase(i) << ' ';
+        }
+        std::cout << '\n';
+        printContainer(s, print<int>);
+    }
+    {
+        std::cout << "\n\nerase(first, last)\n";
+        s.erase(s.lower_bound(g_array_size / 6), s.end());
+        printContainer(s, print<int>);
+    }
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    ft::multiset<int>   s1(g_array, g_array + g_array_size);
+    ft::multiset<int>   s2(g_array, g_array + g_array_size);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << "is equal: " << (s1 == s2) << '\n';
+    s1.insert(0);
+    std::cout << "is not equal: " << (s1 != s2) << '\n';
+    std::cout << "is less than: " << (s1 < s2) << '\n';
+    std::cout << "is greater than: " << (s1 > s2) << '\n';
+    printTime(1);
+}
@@ -0,0 +1,116 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/multiset_tests.hpp"
+
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+
+int main(void) {
+    insertTest();
+    lookupTest();
+    eraseTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    int array[] = { 5, 3, 5, 1, 3, 5, 8, 1, 9, 5 };
+    t_ftMultiset        ftS;
+    t_stdMultiset       stdS;
+
+    printColor(BGWHITE, "\n├─ insert (duplicates are kept)\n");
+    for (int i = 0; i < 10; ++i) {
+        ftS.insert(array[i]);
+        stdS.insert(array[i]);
+    }
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+    printStatus(*ftS.insert(5) == 5 && ftS.size() == 11);
+
+    printColor(BGWHITE, "\n├─ insert range (sorted, with duplicates)\n");
+    {
+        t_ftMultiset    sortedS(stdS.begin(), stdS.end());
+        printStatus(compare_containers(sortedS, stdS, compare<int>));
+    }
+
+    printColor(BGWHITE, "\n├─ insert range (unsorted)\n");
+    {
+        t_ftMultiset    rangeS(array, array + 10);
+        printStatus(compare_containers(rangeS, stdS, compare<int>));
+    }
+
+    printColor(BGWHITE, "\n├─ insert with hint\n");
+    {
+        t_ftMultiset    hintS;
+
+        for (int i = 0; i < 10; ++i) {
+            hintS.insert(hintS.end(), i / 3);
+        }
+        hintS.insert(hintS.begin(), 0);
+        hintS.insert(hintS.find(2), 9);
+        stdS.clear();
+        for (int i = 0; i < 10; ++i) {
+            stdS.insert(i / 3);
+        }
+        stdS.insert(0);
+        stdS.insert(9);
+        printStatus(compare_containers(hintS, stdS, compare<int>));
+    }
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    int array[] = { 5, 3, 5, 1, 3, 5, 8, 1, 9, 5 };
+    const t_ftMultiset  ftS(array, array + 10);
+    t_stdMultiset       stdS(array, array + 10);
+    bool                same = true;
+
+    printColor(BGWHITE, "\n├─ count\n");
+    for (int key = 0; key < 11; ++key) {
+        same = same && ftS.count(key) == stdS.count(key);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ equal_range\n");
+    same = true;
+    for (int key = 0; key < 11; ++key) {
+        ft::pair<t_ftConstIterator, t_ftConstIterator>  ftRange
+                                                        = ftS.equal_range(key);
+        std::pair<t_stdIterator, t_stdIterator>         stdRange
+                                                        = stdS.equal_range(key);
+
+        same = same && std::distance(ftRange.first, ftRange.second)
+                       == std::distance(stdRange.first, stdRange.second)
+                    && ftRange.first == ftS.lower_bound(key)
+                    && ftRange.second == ftS.upper_bound(key);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ find (first of the equal keys)\n");
+    printStatus(ftS.find(5) == ftS.lower_bound(5) && ftS.find(4) == ftS.end());
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    int array[] = { 5, 3, 5, 1, 3, 5, 8, 1, 9, 5 };
+    t_ftMultiset        ftS(array, array + 10);
+    t_stdMultiset       stdS(array, array + 10);
+
+    printColor(BGWHITE, "\n├─ erase(key) returns the number erased\n");
+    printStatus(ftS.erase(5) == 4 && ftS.erase(5) == 0 && ftS.erase(9) == 1);
+    stdS.erase(5);
+    stdS.erase(9);
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) over an equal range\n");
+    t_ftRange       range = ftS.equal_range(3);
+    ftS.erase(range.first, range.second);
+    stdS.erase(3);
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ erase(iterator)\n");
+    ftS.erase(ftS.begin());
+    stdS.erase(stdS.begin());
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+}
@@ -9,6 +9,8 @@ static void operationsTest(void);
 static void insertTest(void);
 static void eraseTest(void);
 static void swapTest(void);
+static void allocatorTest(void);
+static void setAlgebraTest(void);
 
 const int     g_array_size = AMOUNT;
 const int     *g_array = createArray(g_array_size);
@@ -21,6 +23,8 @@ int main(void) {
     insertTest();
     eraseTest();
     swapTest();
+    allocatorTest();
+    setAlgebraTest();
     printTime(RESULT);
     delete[] g_array;
     return 0;
@@ -373,5 +377,129 @@ static void insertTest(void) {
         s.insert(s.begin(), s.end());
         printContainer(s, print<int>);
     }
+    {
+        std::cout << "\n\ninsert with hint (ascending values at end())\n";
+        ft::set<int>             s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(s.end(), i);
+        }
+        printContainer(s, print<int>);
+
+        std::cout << "\n\ninsert with hint (next to the right place)\n";
+        for (int i = 0; i < g_array_size; i += 2) {
+            s.erase(i);
+        }
+        for (int i = 0; i < g_array_size; i += 2) {
+            s.insert(s.find(i + 1), i);
+        }
+        printContainer(s, print<int>);
+
+        std::cout << "\n\ninsert with hint (unsorted values at end())\n";
+        s.clear();
+        for (int i = 0; i < g_array_size; ++i) {
+            s.insert(s.end(), g_array[i]);
+        }
+        printContainer(s, print<int>);
+    }
     printTime(1);
 }
+
+template <typename Set>
+static void allocatorWorkload(void) {
+    Set s(g_array, g_array + g_array_size);
+
+    for (int i = 0; i < g_array_size; i += 2) {
+        s.erase(g_array[i]);
+    }
+    s.insert(g_array, g_array + g_array_size);
+    printContainer(s, print<int>);
+    s.clear();
+}
+
+static void allocatorTest(void) {
+    std::cout << "\n[ ALLOCATOR (default) ]\n";
+    printTime(0);
+    allocatorWorkload<ft::set<int> >();
+    printTime(1);
+
+    std::cout << "\n[ ALLOCATOR (std::allocator) ]\n";
+    printTime(0);
+    allocatorWorkload<t_ftStdAllocSet>();
+    printTime(1);
+}
+
+/**
+ * The std build stands in with the naive merge loop, std::set_* into an
+ * inserter, so the time tests compare it against the in-place tree-to-tree
+ * versions.
+ */
+
+#if STD == 1
+
+template <typename Set>
+static void setAlgebra(Set& x, const Set& y, char op) {
+    Set                         result;
+    std::insert_iterator<Set>   out(result, result.end());
+
+    if (op == '|') {
+        std::set_union(x.begin(), x.end(), y.begin(), y.end(), out);
+    } else if (op == '&') {
+        std::set_intersection(x.begin(), x.end(), y.begin(), y.end(), out);
+    } else {
+        std::set_difference(x.begin(), x.end(), y.begin(), y.end(), out);
+    }
+    x.swap(result);
+}
+
+#else
+
+template <typename Set>
+static void setAlgebra(Set& x, const Set& y, char op) {
+    if (op == '|') {
+        x.unite(y);
+    } else if (op == '&') {
+        x.intersect(y);
+    } else {
+        x.subtract(y);
+    }
+}
+
+#endif
+
+/**
+ * A segment of a tenth of the keys against the whole set, both ways. The
+ * operands are copied before the clock starts, so only the operations
+ * themselves are timed.
+ */
+static void setAlgebraTest(void) {
+    const int           rounds = 20;
+    const ft::set<int>  all(g_array, g_array + g_array_size);
+    ft::set<int>        segment;
+    ft::set<int>        small[rounds];
+    ft::set<int>        large[rounds];
+    const char*         names[] = { "Union", "Intersection", "Difference" };
+    const char          ops[] = { '|', '&', '-' };
+
+    for (int i = 0; i < g_array_size; i += 10) {
+        segment.insert(g_array[i] * 2);
+    }
+    std::cout << "\n[ SET ALGEBRA ]\n";
+    for (int op = 0; op < 3; ++op) {
+        for (int round = 0; round < rounds; ++round) {
+            small[round] = segment;
+            large[round] = all;
+        }
+        std::cout << "\n" << names[op] << "\n";
+        printTime(0);
+        for (int round = 0; round < rounds; ++round) {
+            setAlgebra(small[round], all, ops[op]);
+            setAlgebra(large[round], segment, ops[op]);
+        }
+        printTime(1);
+        std::cout << "\n\n" << names[op] << " of a segment with the set\n";
+        printContainer(small[0], print<int>);
+        std::cout << "\n\n" << names[op] << " of the set with a segment\n";
+        printContainer(large[0], print<int>);
+    }
+}
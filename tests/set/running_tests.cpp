@@ -5,12 +5,22 @@
 static void algorithmsTest(void);
 static void iteratorTest(void);
 static void clearTest(void);
+static void eraseTest(void);
+static void orderStatisticsTest(void);
+static void splitMergeTest(void);
+static void nodeHandleTest(void);
+static void setAlgebraTest(void);
 static void sizeTest(void);
 
 int main(void) {
     algorithmsTest();
     iteratorTest();
     clearTest();
+    eraseTest();
+    orderStatisticsTest();
+    splitMergeTest();
+    nodeHandleTest();
+    setAlgebraTest();
     sizeTest();
     printStatus(RESULT);
     return 0;
@@ -66,6 +76,97 @@ static void clearTest(void) {
     printStatus(compare_containers(ftS, stdS, compare<int>));
 }
 
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    int array[] = { 7, 3, 9, 1, 5, 8, 2, 10, 4, 6 };
+    ft::set<int>             ftS(array, array + 10);
+    std::set<int>            stdS(array, array + 10);
+    bool                     same_ends = true;
+
+    printColor(BGWHITE, "\n├─ erase(begin()) until empty\n");
+    while (!stdS.empty()) {
+        same_ends = same_ends && *ftS.begin() == *stdS.begin()
+                              && *ftS.rbegin() == *stdS.rbegin();
+        ftS.erase(ftS.begin());
+        stdS.erase(stdS.begin());
+    }
+    printStatus(same_ends && ftS.empty() && ftS.begin() == ftS.end());
+
+    printColor(BGWHITE, "\n├─ erase(--end()) until empty\n");
+    ftS.insert(array, array + 10);
+    stdS.insert(array, array + 10);
+    while (!stdS.empty()) {
+        same_ends = same_ends && *ftS.begin() == *stdS.begin()
+                              && *ftS.rbegin() == *stdS.rbegin();
+        ftS.erase(--ftS.end());
+        stdS.erase(--stdS.end());
+    }
+    printStatus(same_ends && ftS.empty() && ftS.begin() == ftS.end());
+
+    printColor(BGWHITE, "\n├─ erase(first, last) (small range)\n");
+    ftS.insert(array, array + 10);
+    stdS.insert(array, array + 10);
+    ftS.erase(ftS.find(4), ftS.find(6));
+    stdS.erase(stdS.find(4), stdS.find(6));
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) (most of the set)\n");
+    ftS.erase(ftS.find(2), ftS.find(10));
+    stdS.erase(stdS.find(2), stdS.find(10));
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+    ftS.insert(5);
+    stdS.insert(5);
+    printStatus(compare_containers(ftS, stdS, compare<int>));
+
+    printColor(BGWHITE, "\n├─ erase(begin(), end())\n");
+    ftS.erase(ftS.begin(), ftS.end());
+    printStatus(ftS.empty() && ftS.begin() == ftS.end());
+}
+
+static void orderStatisticsTest(void) {
+    printColor(CYAN, "\n[ ORDER STATISTICS ]\n");
+    typedef ft::set<int, std::less<int>, ft::pool_allocator<int>,
+                    ft::order_statistics_update>    t_ftRankedSet;
+    int array[] = { 70, 30, 90, 10, 50, 80, 20, 100, 40, 60 };
+    t_ftRankedSet            ftS(array, array + 10);
+    std::set<int>            stdS(array, array + 10);
+    bool                     same = true;
+
+    printColor(BGWHITE, "\n├─ nth(k) and rank(key)\n");
+    std::size_t k = 0;
+    for (std::set<int>::iterator it = stdS.begin(); it != stdS.end(); ++it) {
+        same = same && *ftS.nth(k) == *it && ftS.rank(*it) == k
+                    && ftS.rank(*it + 1) == k + 1;
+        ++k;
+    }
+    printStatus(same && ftS.nth(10) == ftS.end() && ftS.rank(0) == 0);
+
+    printColor(BGWHITE, "\n├─ distance(first, last)\n");
+    printStatus(ftS.distance(ftS.begin(), ftS.end()) == 10
+                && ftS.distance(ftS.find(30), ftS.find(80)) == 5
+                && ftS.distance(ftS.find(80), ftS.find(30)) == -5);
+
+    printColor(BGWHITE, "\n├─ after erase, insert and copy\n");
+    ftS.erase(ftS.find(40), ftS.find(70));
+    stdS.erase(stdS.find(40), stdS.find(70));
+    ftS.erase(100);
+    stdS.erase(100);
+    ftS.insert(ftS.end(), 110);
+    stdS.insert(110);
+    ftS.insert(55);
+    stdS.insert(55);
+
+    const t_ftRankedSet      copy(ftS);
+    k = 0;
+    same = true;
+    for (std::set<int>::iterator it = stdS.begin(); it != stdS.end(); ++it) {
+        same = same && *copy.nth(k) == *it && copy.rank(*it) == k;
+        ++k;
+    }
+    printStatus(same && copy.distance(copy.begin(), copy.end())
+                        == static_cast<long>(stdS.size()));
+}
+
 static void iteratorTest(void) {
     int a[] = { 1, 2, 3, 4, 5 };
     ft::set<int>                     ftS(a, a + 5);
@@ -228,3 +329,134 @@ static void sizeTest(void) {
         printStatus(ftS.size() == stdS.size());
     }
 }
+
+static void splitMergeTest(void) {
+    printColor(CYAN, "\n[ SPLIT AND MERGE ]\n");
+    typedef ft::set<int, std::less<int>, ft::pool_allocator<int>,
+                    ft::order_statistics_update>    t_ftRankedSet;
+    t_ftRankedSet   ftS;
+    std::set<int>   stdS;
+
+    for (int i = 1; i < 2000; i += 2) {
+        ftS.insert(i);
+    }
+    t_ftRankedSet   ftHigh(ftS.key_comp(), ftS.get_allocator());
+
+    printColor(BGWHITE, "\n├─ split_off(key)\n");
+    ftS.split_off(1200, ftHigh);
+    printStatus(ftS.size() == 600 && *ftS.rbegin() == 1199
+                && *ftS.nth(599) == 1199);
+    printStatus(ftHigh.size() == 400 && *ftHigh.begin() == 1201
+                && ftHigh.rank(1501) == 150);
+
+    printColor(BGWHITE, "\n├─ merge (disjoint and overlapping)\n");
+    t_ftRankedSet   ftEven;
+
+    for (int i = 0; i < 2000; i += 2) {
+        ftEven.insert(i);
+        stdS.insert(i);
+        stdS.insert(i + 1);
+    }
+    ftEven.insert(1);
+    ftEven.insert(1999);
+    ftS.merge(ftHigh);
+    ftS.merge(ftEven);
+    printStatus(ftHigh.empty() && ftEven.size() == 2
+                && compare_containers(ftS, stdS, compare<int>));
+    bool    same = true;
+    for (std::size_t k = 0; k < stdS.size(); ++k) {
+        same = same && *ftS.nth(k) == static_cast<int>(k);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ split_off into a non-empty set\n");
+    t_ftRankedSet   ftOther;
+
+    ftOther.insert(5000);
+    ftS.split_off(1500, ftOther);
+    printStatus(ftS.size() == 1500 && ftOther.size() == 501
+                && ftOther.rank(5000) == 500 && *ftOther.begin() == 1500);
+}
+
+static void nodeHandleTest(void) {
+    printColor(CYAN, "\n[ NODE HANDLES ]\n");
+    int array[] = { 7, 3, 9, 1, 5, 8, 2, 10, 4, 6 };
+    ft::set<int>                ftS(array, array + 10);
+    ft::set<int>                ftOdd(ftS.key_comp(), ftS.get_allocator());
+    std::set<int>               stdS(array, array + 10);
+    ft::set<int>::node_type     node;
+
+    printColor(BGWHITE, "\n├─ extract(iterator) and hinted insert\n");
+    for (ft::set<int>::iterator it = ftS.begin(); it != ftS.end();) {
+        ft::set<int>::iterator  next = it;
+
+        ++next;
+        if (*it % 2) {
+            const int*  address = &*it;
+
+            node = ftS.extract(it);
+            stdS.erase(node.value());
+            printStatus(&*ftOdd.insert(ftOdd.end(), node) == address);
+        }
+        it = next;
+    }
+    printStatus(compare_containers(ftS, stdS, compare<int>)
+                && ftOdd.size() == 5 && *ftOdd.rbegin() == 9);
+
+    printColor(BGWHITE, "\n├─ extract(key) and insert back\n");
+    node = ftOdd.extract(5);
+    ft::pair<ft::set<int>::iterator, bool>  ret = ftS.insert(node);
+    stdS.insert(5);
+    printStatus(ret.second && node.empty() && ftOdd.count(5) == 0
+                && compare_containers(ftS, stdS, compare<int>));
+}
+
+static void setAlgebraTest(void) {
+    printColor(CYAN, "\n[ SET ALGEBRA ]\n");
+    ft::set<int>    ftX;
+    ft::set<int>    ftY;
+    std::set<int>   stdX;
+    std::set<int>   stdY;
+
+    srand(7);
+    for (int i = 0; i < 300; ++i) {
+        int x = rand() % 500;
+        int y = rand() % 500;
+
+        ftX.insert(x);
+        stdX.insert(x);
+        if (i % 10 == 0) {
+            ftY.insert(y);
+            stdY.insert(y);
+        }
+    }
+    for (int swapped = 0; swapped < 2; ++swapped) {
+        ft::set<int>    ftU(ftX);
+        ft::set<int>    ftI(ftX);
+        ft::set<int>    ftD(ftX);
+        std::set<int>   stdU;
+        std::set<int>   stdI;
+        std::set<int>   stdD;
+
+        std::set_union(stdX.begin(), stdX.end(), stdY.begin(), stdY.end(),
+                       std::inserter(stdU, stdU.end()));
+        std::set_intersection(stdX.begin(), stdX.end(),
+                              stdY.begin(), stdY.end(),
+                              std::inserter(stdI, stdI.end()));
+        std::set_difference(stdX.begin(), stdX.end(),
+                            stdY.begin(), stdY.end(),
+                            std::inserter(stdD, stdD.end()));
+        ftU.unite(ftY);
+        ftI.intersect(ftY);
+        ftD.subtract(ftY);
+
+        printColor(BGWHITE, swapped ? "\n├─ small with large\n"
+                                    : "\n├─ large with small\n");
+        printStatus(compare_containers(ftU, stdU, compare<int>));
+        printStatus(compare_containers(ftI, stdI, compare<int>));
+        printStatus(compare_containers(ftD, stdD, compare<int>));
+        printStatus(compare_containers(ftY, stdY, compare<int>));
+        ftX.swap(ftY);
+        stdX.swap(stdY);
+    }
+}
@@ -0,0 +1,118 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/small_vector_tests.hpp"
+
+static void constructorsTest(void);
+static void pushBackTest(void);
+static void insertEraseTest(void);
+static void manySmallVectorsTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    pushBackTest();
+    insertEraseTest();
+    manySmallVectorsTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRepeated elements\n";
+        t_ftSmallVector     v(5, 100);
+
+        printContainer(v, print<int>);
+    }
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftSmallVector     v(g_array, g_array + g_array_size);
+
+        printContainer(v, print<int>);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftSmallVector     v1(g_array, g_array + g_array_size);
+        t_ftSmallVector     v2(v1);
+        t_ftSmallVector     v3(3, 1);
+
+        v3 = v2;
+        printContainer(v2, print<int>);
+        printContainer(v3, print<int>);
+    }
+    printTime(1);
+}
+
+static void pushBackTest(void) {
+    std::cout << "\n[ PUSH_BACK ]\n";
+    printTime(0);
+    t_ftSmallVector     v;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        v.push_back(g_array[i]);
+    }
+    printContainer(v, print<int>);
+    while (v.size() > 3) {
+        v.pop_back();
+    }
+    printContainer(v, print<int>);
+    printTime(1);
+}
+
+static void insertEraseTest(void) {
+    std::cout << "\n[ INSERT AND ERASE ]\n";
+    printTime(0);
+    t_ftSmallVector     v;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        v.insert(v.begin() + v.size() / 2, g_array[i]);
+    }
+    v.insert(v.begin() + 1, 3, -1);
+    v.insert(v.end() - 1, g_array, g_array + g_array_size / 2);
+    printContainer(v, print<int>);
+    for (int i = 0; i < g_array_size / 2; ++i) {
+        v.erase(v.begin() + v.size() / 3);
+    }
+    v.erase(v.begin(), v.begin() + v.size() / 2);
+    printContainer(v, print<int>);
+    printTime(1);
+}
+
+/* The case it is made for: a short-lived vector of a few elements. */
+static void manySmallVectorsTest(void) {
+    std::cout << "\n[ MANY SMALL VECTORS ]\n";
+    printTime(0);
+    long    sum = 0;
+
+    for (int i = 0; i < g_array_size * 100; ++i) {
+        t_ftSmallVector     v;
+
+        for (int j = 0; j < 6; ++j) {
+            v.push_back(i + j);
+        }
+        sum += v[i % 6];
+    }
+    std::cout << sum << '\n';
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftSmallVector     v1(g_array, g_array + g_array_size);
+    t_ftSmallVector     v2(v1);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << (v1 == v2) << (v1 != v2) << (v1 < v2) << (v1 <= v2)
+              << (v1 > v2) << (v1 >= v2) << '\n';
+    v2.pop_back();
+    std::cout << (v1 == v2) << (v1 != v2) << (v1 < v2) << (v1 <= v2)
+              << (v1 > v2) << (v1 >= v2) << '\n';
+    printTime(1);
+}
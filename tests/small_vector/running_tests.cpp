@@ -0,0 +1,192 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+/* The debug checks are on, and throw so that they can be tested. */
+#define FT_DEBUG 1
+#define FT_DEBUG_FAILURE(message) throw std::logic_error(message)
+
+#include "../includes/containers/small_vector_tests.hpp"
+
+static void inlineStorageTest(void);
+static void growthPolicyTest(void);
+static void modifiersTest(void);
+static void copySwapTest(void);
+static void accessorsTest(void);
+static void relationalOperatorsTest(void);
+static void stackTest(void);
+
+const int   g_size = 5000;
+
+int main(void) {
+    inlineStorageTest();
+    growthPolicyTest();
+    modifiersTest();
+    copySwapTest();
+    accessorsTest();
+    relationalOperatorsTest();
+    stackTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void inlineStorageTest(void) {
+    printColor(CYAN, "\n[ INLINE STORAGE ]\n");
+    t_ftSmallVector     ftV;
+    t_stdVector         stdV;
+
+    printColor(BGWHITE, "\n├─ up to N elements stay inline\n");
+    for (int i = 0; i < 8; ++i) {
+        ftV.push_back(i);
+        stdV.push_back(i);
+    }
+    printStatus(ftV.is_inline() && ftV.capacity() == 8
+                && compare_containers(ftV, stdV, compare<int>));
+
+    printColor(BGWHITE, "\n├─ the next one moves them to the heap\n");
+    ftV.push_back(8);
+    stdV.push_back(8);
+    printStatus(!ftV.is_inline() && ftV.capacity() >= 9
+                && compare_containers(ftV, stdV, compare<int>));
+
+    printColor(BGWHITE, "\n├─ clear keeps the heap buffer\n");
+    ftV.clear();
+    printStatus(ftV.empty() && !ftV.is_inline() && ftV.capacity() >= 9);
+}
+
+static void growthPolicyTest(void) {
+    printColor(CYAN, "\n[ GROWTH POLICY ]\n");
+    ft::small_vector<int, 4, std::allocator<int>, ft::growth_one_and_half> v;
+    std::vector<size_t> steps(1, v.capacity());
+    bool                grows = true;
+
+    printColor(BGWHITE, "\n├─ growth_one_and_half past the inline buffer\n");
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+        if (v.capacity() != steps.back()) {
+            steps.push_back(v.capacity());
+        }
+    }
+    for (size_t i = 1; i < steps.size(); ++i) {
+        grows = grows && steps[i] == std::max(steps[i - 1] * 3 / 2,
+                                              steps[i - 1] + 1);
+    }
+    printStatus(grows && steps[0] == 4 && steps[1] == 6 && v.size() == 1000);
+}
+
+static void modifiersTest(void) {
+    printColor(CYAN, "\n[ MODIFIERS ]\n");
+    t_ftSmallVector         ftV;
+    t_stdVector             stdV;
+    t_ftSmallStringVector   ftS;
+    std::vector<std::string> stdS;
+    bool                    same = true;
+
+    printColor(BGWHITE, "\n├─ insert, erase and resize at random\n");
+    srand(g_size);
+    for (int i = 0; i < g_size; ++i) {
+        size_t  pos = rand() % (stdV.size() + 1);
+        int     n = rand() % 4;
+
+        switch (rand() % 4) {
+            case 0:
+                ftV.insert(ftV.begin() + pos, n, i);
+                stdV.insert(stdV.begin() + pos, n, i);
+                break;
+            case 1: {
+                t_stdVector range(stdV.rbegin(), stdV.rbegin() + pos);
+
+                ftV.insert(ftV.begin() + pos, range.begin(), range.end());
+                stdV.insert(stdV.begin() + pos, range.begin(), range.end());
+                break;
+            }
+            case 2:
+                if (pos + n <= stdV.size()) {
+                    ftV.erase(ftV.begin() + pos, ftV.begin() + pos + n);
+                    stdV.erase(stdV.begin() + pos, stdV.begin() + pos + n);
+                }
+                break;
+            default:
+                ftV.resize(pos + n, i);
+                stdV.resize(pos + n, i);
+        }
+        same = same && compare_containers(ftV, stdV, compare<int>);
+    }
+    printStatus(same);
+
+    printColor(BGWHITE, "\n├─ inserting an element of the vector itself\n");
+    ftV.insert(ftV.begin(), ftV.back());
+    stdV.insert(stdV.begin(), stdV.back());
+    ftV.insert(ftV.end() - 1, 5, ftV.front());
+    stdV.insert(stdV.end() - 1, 5, stdV.front());
+    printStatus(compare_containers(ftV, stdV, compare<int>));
+
+    printColor(BGWHITE, "\n├─ elements that are copied, not relocated\n");
+    for (int i = 0; i < 100; ++i) {
+        std::ostringstream  word;
+
+        word << "a string longer than the short string buffer " << i;
+        ftS.insert(ftS.begin() + ftS.size() / 2, word.str());
+        stdS.insert(stdS.begin() + stdS.size() / 2, word.str());
+        if (i % 3 == 0) {
+            ftS.erase(ftS.begin());
+            stdS.erase(stdS.begin());
+        }
+    }
+    printStatus(compare_containers(ftS, stdS, compare<std::string>));
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_ftSmallVector     small(3, 42);
+    t_ftSmallVector     large(100, 7);
+    t_ftSmallVector     copy(large);
+
+    printColor(BGWHITE, "\n├─ copy constructor and assignment\n");
+    small = large;
+    printStatus(copy == large && small == large && copy.data() != large.data());
+
+    printColor(BGWHITE, "\n├─ swap between inline and heap storage\n");
+    t_ftSmallVector     inlineV(3, 42);
+    ft::swap(inlineV, large);
+    printStatus(inlineV == copy && large.size() == 3 && large[2] == 42);
+}
+
+static void accessorsTest(void) {
+    printColor(CYAN, "\n[ ACCESSORS ]\n");
+    int             a[] = { 1, 2, 3, 4, 5 };
+    t_ftSmallVector ftV(a, a + 5);
+    bool            threw = false;
+
+    try {
+        ftV.at(5);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    printStatus(threw && ftV.at(4) == 5 && ftV[0] == 1 && ftV.front() == 1
+                && ftV.back() == 5 && *ftV.rbegin() == 5
+                && ftV.end() - ftV.begin() == 5);
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_ftSmallVector     x(5, 1);
+    t_ftSmallVector     y(x);
+
+    printStatus(x == y && x <= y && x >= y && !(x < y));
+    y.push_back(0);
+    printStatus(x != y && x < y && y > x && !(y <= x));
+}
+
+static void stackTest(void) {
+    printColor(CYAN, "\n[ STACK ]\n");
+    ft::stack<int, t_ftSmallVector>     ftStack;
+    bool                                same = true;
+
+    for (int i = 0; i < 20; ++i) {
+        ftStack.push(i);
+    }
+    for (int i = 19; i >= 0; --i) {
+        same = same && ftStack.top() == i;
+        ftStack.pop();
+    }
+    printStatus(same && ftStack.empty());
+}
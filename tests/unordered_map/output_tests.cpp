@@ -0,0 +1,316 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/unordered_map_tests.hpp"
+
+static void relationalOperatorsTest(void);
+static void assignmentOperatorTest(void);
+static void constructorsTest(void);
+static void operationsTest(void);
+static void insertTest(void);
+static void eraseTest(void);
+static void swapTest(void);
+static void allocatorTest(void);
+
+const std::size_t       g_size = AMOUNT;
+const t_ftStrIntPair*   g_pairs = createPairs(g_size);
+const t_ftStrIntPair*   g_pairs_end = g_pairs + g_size;
+
+int main(void) {
+    relationalOperatorsTest();
+    assignmentOperatorTest();
+    constructorsTest();
+    operationsTest();
+    insertTest();
+    eraseTest();
+    swapTest();
+    allocatorTest();
+    printTime(RESULT);
+    delete[] g_pairs;
+    return 0;
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nEmpty map\n";
+        t_ftUnorderedMap    m;
+
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\nRange constructor (pointer)\n";
+        t_ftUnorderedMap    m(g_pairs, g_pairs_end);
+
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\nRange constructor (iterator)\n";
+        const t_ftUnorderedMap  to_copy_from(g_pairs, g_pairs_end);
+        t_ftUnorderedMap        m(to_copy_from.begin(), to_copy_from.end());
+
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\nCopy constructor\n";
+        const t_ftUnorderedMap  m1(g_pairs, g_pairs_end);
+        t_ftUnorderedMap        m2(m1);
+
+        printSorted(m1);
+        printSorted(m2);
+    }
+    {
+        std::cout << "\n\nCopy constructor with empty map\n";
+        t_ftUnorderedMap    m1;
+        t_ftUnorderedMap    m2(m1);
+
+        printSorted(m1);
+        printSorted(m2);
+    }
+    printTime(1);
+}
+
+static void swapTest(void) {
+    std::cout << "\n[ SWAP ]\n";
+    printTime(0);
+    t_ftUnorderedMap    m1(g_pairs, g_pairs + g_size / 2);
+    t_ftUnorderedMap    m2(g_pairs + g_size / 2, g_pairs_end);
+
+    m1.swap(m2);
+    printSorted(m1);
+    printSorted(m2);
+
+    swap(m1, m2);
+    printSorted(m1);
+    printSorted(m2);
+    printTime(1);
+}
+
+static void operationsTest(void) {
+    t_ftUnorderedMap    m;
+    std::string         str("a");
+
+    for (int i = 0; i < 100; i++) {
+        m[str] = i;
+        ++str[0];
+    }
+    const t_ftUnorderedMap  constM(m);
+
+    std::cout << "\n[ OPERATIONS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n[ FIND ]\n";
+        for (int i = 0; i < static_cast<int>(g_size); ++i) {
+            t_ftIterator    it = m.find(std::string(1, 'a' + i % 30));
+
+            if (it != m.end()) {
+                std::cout << "Found key: " << it->first
+                          << " value: " << it->second << '\n';
+            } else {
+                std::cout << "Element not found\n";
+            }
+        }
+    }
+    {
+        std::cout << "\n[ FIND (const) ]\n";
+        for (int i = 0; i < static_cast<int>(g_size); ++i) {
+            t_ftConstIterator   it = constM.find(std::string(1, 'a' + i % 30));
+
+            std::cout << (it == constM.end() ? -1 : it->second) << ' ';
+        }
+        std::cout << '\n';
+    }
+    {
+        std::cout << "\n[ COUNT ]\n";
+
+        std::cout << "Found " << m.count("b")
+                  << " elements with key b\n";
+
+        std::cout << "Found " << m.count("bb")
+                  << " elements with key bb\n";
+    }
+    {
+        std::cout << "\n[ EQUAL_RANGE ]\n";
+
+        ft::pair<t_ftIterator, t_ftIterator> ret = m.equal_range("b");
+        std::cout << "range holds: ";
+        for (; ret.first != ret.second; ++ret.first) {
+            std::cout << ret.first->first << " => " << ret.first->second;
+        }
+        std::cout << '\n';
+        ret = m.equal_range("bb");
+        std::cout << "empty range: " << (ret.first == ret.second) << '\n';
+    }
+    {
+        std::cout << "\n[ AT ]\n";
+        try {
+            std::cout << constM.at("c") << '\n';
+            std::cout << constM.at("cc") << '\n';
+        } catch (const std::out_of_range&) {
+            std::cout << "out_of_range\n";
+        }
+    }
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftUnorderedMap    M1(g_pairs, g_pairs_end);
+    t_ftUnorderedMap    M2(g_pairs, g_pairs_end);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << "\n\noperator ==\n";
+    std::cout << "is equal: " << (M1 == M2);
+
+    std::cout << "\n\noperator !=\n";
+    M1.erase(g_pairs[0].first);
+    std::cout << "is not equal: " << (M1 != M2);
+    M1.insert(g_pairs[0]);
+    std::cout << "\nis equal again: " << (M1 == M2);
+    M1[g_pairs[0].first] += 1;
+    std::cout << "\nvalue differs: " << (M1 != M2);
+    std::cout << '\n';
+    printTime(1);
+}
+
+static void assignmentOperatorTest(void) {
+    std::cout << "\n[ ASSIGNMENT OPERATOR ]\n";
+    printTime(0);
+    {
+        t_ftUnorderedMap    m1;
+        {
+            t_ftUnorderedMap    m2(g_pairs, g_pairs + g_size / 3);
+            m1 = m2;
+        }
+        printSorted(m1);
+    }
+    {
+        t_ftUnorderedMap    m1;
+        t_ftUnorderedMap    m2(g_pairs, g_pairs + g_size / 2);
+
+        m1 = m2;
+        printSorted(m1);
+        printSorted(m2);
+
+        t_ftUnorderedMap    m3(g_pairs, g_pairs_end);
+        m1 = m3;
+        printSorted(m1);
+        printSorted(m3);
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        t_ftUnorderedMap    m(g_pairs, g_pairs_end);
+
+        std::cout << "\n\nErase single element (iterator)\n";
+        m.erase(m.find(g_pairs[0].first));
+        printSorted(m);
+
+        std::cout << "\n\nErase single element (key)\n";
+        for (std::size_t i = 0; i < g_size; i += 2) {
+            std::cout << m.erase(g_pairs[i].first);
+        }
+        std::cout << '\n';
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\nErase every element while iterating\n";
+        t_ftUnorderedMap    m(g_pairs, g_pairs_end);
+
+        for (t_ftIterator it = m.begin(); it != m.end(); ) {
+            m.erase(it++);
+        }
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\nErase a range of elements\n";
+        t_ftUnorderedMap    m(g_pairs, g_pairs_end);
+
+        m.erase(m.begin(), m.end());
+        printSorted(m);
+        m.insert(g_pairs, g_pairs_end);
+        printSorted(m);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    t_ftUnorderedMap    m;
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        t_ftIterator    it;
+
+        std::cout << "\n\ninsert single element (1/3)\n";
+        it = m.insert(m.begin(), ft::make_pair(std::string("10"), 42));
+
+        printSorted(m);
+        std::cout << "insert return: Key: " << it->first
+                  << " Value: " << it->second << '\n';
+
+        std::cout << "\n\ninsert single element (2/3)\n";
+        std::cout << m.insert(ft::make_pair(std::string("42"), 10)).second;
+        std::cout << m.insert(ft::make_pair(std::string("42"), 11)).second;
+        printSorted(m);
+
+        std::cout << "\n\ninsert single element (3/3)\n";
+        m.insert(m.end(), ft::make_pair(std::string("12"), 12));
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\ninsert multiple elements (1/3)\n";
+        m.insert(g_pairs, g_pairs + g_size * 3 / 10);
+        printSorted(m);
+
+        std::cout << "\n\ninsert multiple elements (2/3)\n";
+        m.insert(g_pairs + g_size / 2, g_pairs + g_size * 8 / 10);
+        printSorted(m);
+
+        std::cout << "\n\ninsert multiple elements (3/3)\n";
+        m.insert(g_pairs + g_size * 3 / 10, g_pairs_end);
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\ninsert to itself\n";
+        t_ftUnorderedMap    m(g_pairs, g_pairs_end);
+
+        m.insert(m.begin(), m.end());
+        printSorted(m);
+    }
+    {
+        std::cout << "\n\noperator[]\n";
+        t_ftIntUnorderedMap m;
+
+        for (std::size_t i = 0; i < g_size * 4; ++i) {
+            m[i % (g_size + 1)] += i;
+        }
+        for (std::size_t i = 0; i <= g_size; ++i) {
+            std::cout << m[i] << ' ';
+        }
+        std::cout << "\nsize: " << m.size() << '\n';
+    }
+    printTime(1);
+}
+
+template <typename Map>
+static void allocatorWorkload(void) {
+    Map m(g_pairs, g_pairs_end);
+
+    for (std::size_t i = 0; i < g_size; i += 2) {
+        m.erase(g_pairs[i].first);
+    }
+    m.insert(g_pairs, g_pairs_end);
+    printSorted(m);
+    m.clear();
+}
+
+static void allocatorTest(void) {
+    std::cout << "\n[ ALLOCATOR (std::allocator) ]\n";
+    printTime(0);
+    allocatorWorkload<t_ftUnorderedMap>();
+    printTime(1);
+}
@@ -0,0 +1,323 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/unordered_map_tests.hpp"
+
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void iteratorsTest(void);
+static void copySwapTest(void);
+static void elementAccessTest(void);
+static void relationalOperatorsTest(void);
+static void bucketInterfaceTest(void);
+static void customHashTest(void);
+
+/* Enough elements for the table to grow and rehash several times. */
+const int   g_size = 20000;
+
+static void fill(t_ftIntUnorderedMap* ftM, t_stdMap* stdM, int size) {
+    srand(size);
+    for (int i = 0; i < size; ++i) {
+        int key = rand() % (size * 2);
+
+        ftM->insert(ft::make_pair(key, i));
+        stdM->insert(std::make_pair(key, i));
+    }
+}
+
+int main(void) {
+    insertTest();
+    lookupTest();
+    eraseTest();
+    iteratorsTest();
+    copySwapTest();
+    elementAccessTest();
+    relationalOperatorsTest();
+    bucketInterfaceTest();
+    customHashTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftIntUnorderedMap ftM;
+    t_stdMap            stdM;
+
+    printColor(BGWHITE, "\n├─ insert (random keys, duplicates rejected)\n");
+    fill(&ftM, &stdM, g_size);
+    printStatus(sameElements(ftM, stdM));
+    int                             stored = stdM.begin()->first;
+    ft::pair<t_ftIntIterator, bool> ret;
+
+    ret = ftM.insert(ft::make_pair(stored, -1));
+    printStatus(!ret.second && ret.first->first == stored
+                && ret.first->second == stdM[stored]);
+
+    printColor(BGWHITE, "\n├─ insert range and insert with hint\n");
+    t_ftIntUnorderedMap rangeM(ftM.begin(), ftM.end());
+    printStatus(sameElements(rangeM, stdM));
+    for (int i = 0; i < g_size; ++i) {
+        t_ftIntIterator it = rangeM.insert(rangeM.begin(),
+                                           ft::make_pair(-i, i));
+        stdM.insert(std::make_pair(-i, i));
+        if (it->first != -i) {
+            break;
+        }
+    }
+    printStatus(sameElements(rangeM, stdM));
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_ftIntUnorderedMap         ftM;
+    t_stdMap                    stdM;
+    const t_ftIntUnorderedMap&  constM = ftM;
+    bool                        same = true;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ find, count and equal_range\n");
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftIntUnorderedMap::const_iterator it = constM.find(key);
+        t_stdIterator                       stdIt = stdM.find(key);
+        ft::pair<t_ftIntIterator, t_ftIntIterator>  range =
+                                                    ftM.equal_range(key);
+
+        same = same && ftM.count(key) == stdM.count(key)
+                    && (it == constM.end()) == (stdIt == stdM.end())
+                    && (it == constM.end() || it->second == stdIt->second)
+                    && range.first == it
+                    && (range.first == range.second) == !stdM.count(key);
+    }
+    printStatus(same);
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    t_ftIntUnorderedMap ftM;
+    t_stdMap            stdM;
+    bool                same = true;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ erase(key) returns the number erased\n");
+    for (int key = 0; key < g_size * 2; key += 3) {
+        same = same && ftM.erase(key) == stdM.erase(key);
+    }
+    printStatus(same && sameElements(ftM, stdM));
+
+    printColor(BGWHITE, "\n├─ erase(iterator) while iterating\n");
+    for (t_ftIntIterator it = ftM.begin(); it != ftM.end(); ) {
+        if (it->first % 2) {
+            stdM.erase(it->first);
+            ftM.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    printStatus(sameElements(ftM, stdM));
+
+    printColor(BGWHITE, "\n├─ erased slots are reused\n");
+    for (int round = 0; round < 10; ++round) {
+        for (int key = 0; key < g_size; ++key) {
+            ftM[g_size * 4 + key] = round;
+            stdM[g_size * 4 + key] = round;
+        }
+        for (int key = 0; key < g_size; ++key) {
+            ftM.erase(g_size * 4 + key);
+            stdM.erase(g_size * 4 + key);
+        }
+    }
+    printStatus(sameElements(ftM, stdM));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) down to empty\n");
+    ftM.erase(ftM.begin(), ftM.end());
+    printStatus(ftM.empty() && ftM.begin() == ftM.end());
+    ftM.insert(ft::make_pair(1, 1));
+    printStatus(ftM.size() == 1 && ftM.begin()->first == 1);
+}
+
+static void iteratorsTest(void) {
+    printColor(CYAN, "\n[ ITERATORS ]\n");
+    t_ftIntUnorderedMap ftM;
+    t_stdMap            stdM;
+    t_stdMap            visited;
+
+    fill(&ftM, &stdM, g_size);
+    printColor(BGWHITE, "\n├─ every element is visited once\n");
+    for (t_ftIntIterator it = ftM.begin(); it != ftM.end(); ++it) {
+        visited.insert(std::make_pair(it->first, (*it).second));
+    }
+    printStatus(visited == stdM
+                && static_cast<int>(std::distance(ftM.begin(), ftM.end()))
+                    == static_cast<int>(stdM.size()));
+
+    printColor(BGWHITE, "\n├─ writing through an iterator\n");
+    for (t_ftIntIterator it = ftM.begin(); it != ftM.end(); ++it) {
+        it->second = -it->first;
+    }
+    for (t_stdIterator it = stdM.begin(); it != stdM.end(); ++it) {
+        it->second = -it->first;
+    }
+    printStatus(sameElements(ftM, stdM));
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_ftUnorderedMap    ftM;
+    t_stdStrMap         stdM;
+    std::stringstream   ss;
+
+    for (int i = 0; i < g_size; ++i) {
+        std::string key;
+
+        ss.clear();
+        ss << (i * 7919) % g_size, ss >> key;
+        ftM.insert(ft::make_pair(key, i));
+        stdM.insert(std::make_pair(key, i));
+    }
+    printColor(BGWHITE, "\n├─ copy constructor and assignment\n");
+    t_ftUnorderedMap    copy(ftM);
+    t_ftUnorderedMap    assigned;
+
+    assigned.insert(ft::make_pair(std::string("x"), 1));
+    assigned = copy;
+    printStatus(sameElements(copy, stdM) && sameElements(assigned, stdM));
+
+    printColor(BGWHITE, "\n├─ the copy is independent\n");
+    copy.erase(copy.begin(), copy.end());
+    printStatus(sameElements(ftM, stdM) && copy.empty());
+
+    printColor(BGWHITE, "\n├─ swap\n");
+    t_ftUnorderedMap    other;
+
+    other.insert(ft::make_pair(std::string("only"), 1));
+    ft::swap(other, ftM);
+    printStatus(sameElements(other, stdM)
+                && ftM.size() == 1 && ftM.begin()->first == "only");
+}
+
+/* Counts its calls, to check how often a key gets hashed. */
+static int  g_hashes = 0;
+
+struct countingHash {
+    std::size_t operator()(int x) const {
+        ++g_hashes;
+        return x;
+    }
+};
+
+static void elementAccessTest(void) {
+    printColor(CYAN, "\n[ ELEMENT ACCESS ]\n");
+    t_ftIntUnorderedMap ftM;
+    t_stdMap            stdM;
+
+    printColor(BGWHITE, "\n├─ operator[]\n");
+    for (int i = 0; i < g_size; ++i) {
+        ftM[i % 1000] += i;
+        stdM[i % 1000] += i;
+    }
+    printStatus(sameElements(ftM, stdM));
+
+    printColor(BGWHITE, "\n├─ operator[] hashes its key once\n");
+    ft::unordered_map<int, int, countingHash>   counted(64);
+
+    g_hashes = 0;
+    counted[7] = 1;
+    const bool  miss = g_hashes == 1;
+    counted[7] += 1;
+    printStatus(miss && g_hashes == 2 && counted.size() == 1);
+
+    printColor(BGWHITE, "\n├─ at() throws on missing keys\n");
+    bool    thrown = false;
+    try {
+        ftM.at(1000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    printStatus(thrown && ftM.at(999) == stdM.at(999) && ftM.size() == 1000);
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_ftIntUnorderedMap ftM;
+    t_stdMap            stdM;
+
+    fill(&ftM, &stdM, g_size);
+    t_ftIntUnorderedMap ftOther;
+
+    for (t_stdMap::reverse_iterator it = stdM.rbegin();
+            it != stdM.rend(); ++it) {
+        ftOther.insert(ft::make_pair(it->first, it->second));
+    }
+
+    printStatus(ftM == ftOther && !(ftM != ftOther));
+    ftOther.erase(stdM.begin()->first);
+    printStatus(ftM != ftOther && !(ftM == ftOther));
+    ftOther[stdM.begin()->first] = stdM.begin()->second + 1;
+    printStatus(ftM != ftOther);
+}
+
+static void bucketInterfaceTest(void) {
+    printColor(CYAN, "\n[ BUCKET INTERFACE ]\n");
+    t_ftIntUnorderedMap ftM;
+
+    printColor(BGWHITE, "\n├─ the load factor stays under its maximum\n");
+    bool    under = true;
+    for (int i = 0; i < g_size; ++i) {
+        ftM[i] = i;
+        under = under && ftM.load_factor() <= ftM.max_load_factor();
+    }
+    printStatus(under && ftM.bucket_count() >= ftM.size());
+
+    printColor(BGWHITE, "\n├─ reserve() keeps iterators valid after it\n");
+    t_ftIntUnorderedMap reserved;
+
+    reserved.reserve(g_size);
+    std::size_t     buckets = reserved.bucket_count();
+    t_ftIntIterator first = reserved.insert(ft::make_pair(-1, -1)).first;
+    for (int i = 0; i < g_size - 1; ++i) {
+        reserved[i] = i;
+    }
+    printStatus(reserved.bucket_count() == buckets && first->first == -1
+                && reserved.find(-1) == first);
+
+    printColor(BGWHITE, "\n├─ rehash()\n");
+    ftM.rehash(g_size * 4);
+    bool    grown = ftM.bucket_count() >= static_cast<std::size_t>(g_size * 4);
+    for (int i = 0; i < g_size; i += 2) {
+        ftM.erase(i);
+    }
+    ftM.rehash(0);
+    bool    found = true;
+    for (int i = 0; i < g_size; ++i) {
+        found = found && ftM.count(i) == static_cast<std::size_t>(i % 2);
+    }
+    printStatus(grown && found && ftM.size() == g_size / 2
+                && ftM.bucket_count() < static_cast<std::size_t>(g_size * 4));
+}
+
+/* Only three distinct hashes: every lookup probes long collision chains. */
+struct collidingHash {
+    std::size_t operator()(int x) const { return x % 3; }
+};
+
+static void customHashTest(void) {
+    printColor(CYAN, "\n[ CUSTOM HASH ]\n");
+    ft::unordered_map<int, int, collidingHash>  ftM;
+    t_stdMap                                    stdM;
+
+    srand(g_size);
+    for (int i = 0; i < 2000; ++i) {
+        int key = rand() % 1000;
+
+        if (i % 3) {
+            ftM[key] = i;
+            stdM[key] = i;
+        } else {
+            ftM.erase(key);
+            stdM.erase(key);
+        }
+    }
+    printColor(BGWHITE, "\n├─ colliding keys\n");
+    printStatus(sameElements(ftM, stdM));
+}
@@ -0,0 +1,128 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/unordered_set_tests.hpp"
+
+static void constructorsTest(void);
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void relationalOperatorsTest(void);
+
+const int     g_array_size = AMOUNT;
+const int     *g_array = createArray(g_array_size);
+
+int main(void) {
+    constructorsTest();
+    insertTest();
+    lookupTest();
+    eraseTest();
+    relationalOperatorsTest();
+    printTime(RESULT);
+    delete[] g_array;
+    return 0;
+}
+
+static void constructorsTest(void) {
+    std::cout << "\n[ CONSTRUCTORS ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nRange constructor\n";
+        t_ftUnorderedSet    s(g_array, g_array + g_array_size);
+
+        printSorted(s);
+    }
+    {
+        std::cout << "\n\nCopy constructor and assignment\n";
+        t_ftUnorderedSet    s1(g_array, g_array + g_array_size);
+        t_ftUnorderedSet    s2(s1);
+        t_ftUnorderedSet    s3;
+
+        s3.insert(-1);
+        s3 = s2;
+        printSorted(s2);
+        printSorted(s3);
+    }
+    printTime(1);
+}
+
+static void insertTest(void) {
+    std::cout << "\n[ INSERT ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\ninsert single elements\n";
+        t_ftUnorderedSet    s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            std::cout << s.insert(g_array[i] / 2).second;
+        }
+        std::cout << '\n';
+        printSorted(s);
+    }
+    {
+        std::cout << "\n\ninsert with hint\n";
+        t_ftUnorderedSet    s;
+
+        for (int i = 0; i < g_array_size; ++i) {
+            std::cout << *s.insert(s.end(), i * 2);
+        }
+        std::cout << '\n';
+        printSorted(s);
+    }
+    printTime(1);
+}
+
+static void lookupTest(void) {
+    t_ftUnorderedSet    s;
+
+    for (int i = 0; i < g_array_size; ++i) {
+        s.insert(g_array[i] * 2);
+    }
+    std::cout << "\n[ LOOKUP ]\n";
+    printTime(0);
+    for (int i = -1; i <= g_array_size * 2; ++i) {
+        t_ftIterator    found = s.find(i);
+
+        std::cout << i << ": " << s.count(i)
+                  << ' ' << (found != s.end() ? *found : -1) << '\n';
+    }
+    printTime(1);
+}
+
+static void eraseTest(void) {
+    t_ftUnorderedSet    s(g_array, g_array + g_array_size);
+
+    std::cout << "\n[ ERASE ]\n";
+    printTime(0);
+    {
+        std::cout << "\n\nerase(key) and erase(iterator)\n";
+        for (int i = 0; i < g_array_size; i += 2) {
+            std::cout << s.erase(g_array[i]);
+            if (i + 1 < g_array_size) {
+                s.erase(s.find(g_array[i + 1]));
+            }
+        }
+        std::cout << '\n';
+        printSorted(s);
+    }
+    {
+        std::cout << "\n\nerase(first, last)\n";
+        s.insert(g_array, g_array + g_array_size);
+        s.erase(s.begin(), s.end());
+        printSorted(s);
+    }
+    printTime(1);
+}
+
+static void relationalOperatorsTest(void) {
+    t_ftUnorderedSet    s1(g_array, g_array + g_array_size);
+    t_ftUnorderedSet    s2(s1);
+
+    std::cout << "\n[ RELATIONAL OPERATORS ]\n";
+    printTime(0);
+    std::cout << (s1 == s2) << (s1 != s2) << '\n';
+    s2.erase(g_array[0]);
+    std::cout << (s1 == s2) << (s1 != s2) << '\n';
+    s2.insert(g_array[0]);
+    std::cout << (s1 == s2) << (s1 != s2) << '\n';
+    printTime(1);
+}
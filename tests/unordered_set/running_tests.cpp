@@ -0,0 +1,131 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#include "../includes/containers/unordered_set_tests.hpp"
+
+static void insertTest(void);
+static void lookupTest(void);
+static void eraseTest(void);
+static void copySwapTest(void);
+static void relationalOperatorsTest(void);
+
+/* Enough elements for the table to grow and rehash several times. */
+const int   g_size = 20000;
+
+static void fill(t_ftUnorderedSet* ftS, t_stdSet* stdS, int size) {
+    srand(size);
+    for (int i = 0; i < size; ++i) {
+        int key = rand() % (size * 2);
+
+        ftS->insert(key);
+        stdS->insert(key);
+    }
+}
+
+int main(void) {
+    insertTest();
+    lookupTest();
+    eraseTest();
+    copySwapTest();
+    relationalOperatorsTest();
+    printStatus(RESULT);
+    return 0;
+}
+
+static void insertTest(void) {
+    printColor(CYAN, "\n[ INSERT ]\n");
+    t_ftUnorderedSet    ftS;
+    t_stdSet            stdS;
+
+    printColor(BGWHITE, "\n├─ insert (random keys, duplicates rejected)\n");
+    fill(&ftS, &stdS, g_size);
+    printStatus(sameElements(ftS, stdS));
+    ft::pair<t_ftIterator, bool>    ret = ftS.insert(*stdS.begin());
+    printStatus(!ret.second && *ret.first == *stdS.begin());
+
+    printColor(BGWHITE, "\n├─ insert range\n");
+    t_ftUnorderedSet    rangeS(stdS.begin(), stdS.end());
+    printStatus(sameElements(rangeS, stdS));
+}
+
+static void lookupTest(void) {
+    printColor(CYAN, "\n[ LOOKUP ]\n");
+    t_ftUnorderedSet    ftS;
+    t_stdSet            stdS;
+    bool                same = true;
+
+    fill(&ftS, &stdS, g_size);
+    printColor(BGWHITE, "\n├─ find, count and equal_range\n");
+    for (int key = -1; key <= g_size * 2; ++key) {
+        t_ftIterator                            found = ftS.find(key);
+        ft::pair<t_ftIterator, t_ftIterator>    range = ftS.equal_range(key);
+
+        same = same && ftS.count(key) == stdS.count(key)
+                    && (found == ftS.end()) == !stdS.count(key)
+                    && (found == ftS.end() || *found == key)
+                    && range.first == found
+                    && (range.first == range.second) == !stdS.count(key);
+    }
+    printStatus(same);
+}
+
+static void eraseTest(void) {
+    printColor(CYAN, "\n[ ERASE ]\n");
+    t_ftUnorderedSet    ftS;
+    t_stdSet            stdS;
+    bool                same = true;
+
+    fill(&ftS, &stdS, g_size);
+    printColor(BGWHITE, "\n├─ erase(key) and erase(iterator)\n");
+    for (int key = 0; key < g_size * 2; key += 2) {
+        same = same && ftS.erase(key) == stdS.erase(key);
+        if (ftS.count(key + 1)) {
+            ftS.erase(ftS.find(key + 1));
+            stdS.erase(key + 1);
+        }
+    }
+    printStatus(same && sameElements(ftS, stdS));
+
+    printColor(BGWHITE, "\n├─ erase(first, last) and refill\n");
+    fill(&ftS, &stdS, g_size);
+    ftS.erase(ftS.begin(), ftS.end());
+    printStatus(ftS.empty() && ftS.begin() == ftS.end());
+    stdS.clear();
+    fill(&ftS, &stdS, g_size / 2);
+    printStatus(sameElements(ftS, stdS));
+}
+
+static void copySwapTest(void) {
+    printColor(CYAN, "\n[ COPY AND SWAP ]\n");
+    t_ftUnorderedSet    ftS;
+    t_stdSet            stdS;
+
+    fill(&ftS, &stdS, g_size);
+    t_ftUnorderedSet    copy(ftS);
+    t_ftUnorderedSet    other;
+
+    other.insert(-1);
+    printColor(BGWHITE, "\n├─ copy constructor\n");
+    printStatus(sameElements(copy, stdS));
+
+    printColor(BGWHITE, "\n├─ swap\n");
+    ft::swap(copy, other);
+    printStatus(sameElements(other, stdS)
+                && copy.size() == 1 && *copy.begin() == -1);
+
+    printColor(BGWHITE, "\n├─ assignment over a non-empty set\n");
+    copy = other;
+    printStatus(sameElements(copy, stdS));
+}
+
+static void relationalOperatorsTest(void) {
+    printColor(CYAN, "\n[ RELATIONAL OPERATORS ]\n");
+    t_ftUnorderedSet    ftS;
+    t_stdSet            stdS;
+
+    fill(&ftS, &stdS, g_size);
+    t_ftUnorderedSet    ftOther(stdS.rbegin(), stdS.rend());
+
+    printStatus(ftS == ftOther && !(ftS != ftOther));
+    ftOther.erase(*stdS.begin());
+    printStatus(ftS != ftOther && !(ftS == ftOther));
+}
@@ -9,11 +9,18 @@ static void insertTest(void);
 static void assignTest(void);
 static void eraseTest(void);
 static void swapTest(void);
+static void bigPushBackTest(void);
 
 const int     g_array_size = AMOUNT;
 const int     *g_array = createArray(g_array_size);
 
 int main(void) {
+    if (BIG_TEST) {
+        bigPushBackTest();
+        printTime(RESULT);
+        delete[] g_array;
+        return 0;
+    }
     relationalOperatorsTest();
     assignmentOperatorTest();
     constructorsTest();
@@ -313,3 +320,19 @@ static void assignTest(void) {
     }
     printTime(1);
 }
+
+/* Past the mmap threshold, each reallocation moves the whole vector. */
+static void bigPushBackTest(void) {
+    std::cout << "\n[ PUSH_BACK " << (BIG_AMOUNT * sizeof(int) >> 20)
+              << " MB ]\n";
+    printTime(0);
+    {
+        ft::vector<int>     v;
+
+        for (size_t i = 0; i < BIG_AMOUNT; ++i) {
+            v.push_back(static_cast<int>(i));
+        }
+        std::cout << v.size() << ' ' << v.back() << '\n';
+    }
+    printTime(1);
+}
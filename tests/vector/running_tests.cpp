@@ -1,5 +1,9 @@
 /* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
 
+/* The debug checks are on, and throw so that they can be tested. */
+#define FT_DEBUG 1
+#define FT_DEBUG_FAILURE(message) throw std::logic_error(message)
+
 #include "../includes/containers/vector_tests.hpp"
 
 static void algorithmsTest(void);
@@ -9,6 +13,8 @@ static void iteratorTest(void);
 static void pushBackTest(void);
 static void popBackTest(void);
 static void reserveTest(void);
+static void relocationTest(void);
+static void growthPolicyTest(void);
 static void resizeTest(void);
 static void clearTest(void);
 static void sizeTest(void);
@@ -21,6 +27,8 @@ int main(void) {
     pushBackTest();
     popBackTest();
     reserveTest();
+    relocationTest();
+    growthPolicyTest();
     resizeTest();
     clearTest();
     sizeTest();
@@ -162,6 +170,150 @@ static void reserveTest(void) {
     }
 }
 
+int t_buffer::copies = 0;
+
+static bool sameBuffers(const ft::vector<t_buffer>& ftV,
+                        const std::vector<int>& stdV) {
+    if (ftV.size() != stdV.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < stdV.size(); ++i) {
+        if (*ftV[i].value != stdV[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void relocationTest(void) {
+    printColor(CYAN, "\n[ RELOCATION ]\n");
+    {
+        printColor(BGWHITE,
+            "\n├─ trivially copyable and relocatable types\n");
+        printStatus(ft::is_trivially_copyable<int>::value
+                    && ft::is_trivially_copyable<int*>::value
+                    && !ft::is_trivially_copyable<std::string>::value
+                    && !ft::is_trivially_relocatable<std::string>::value
+                    && ft::is_trivially_relocatable<t_buffer>::value);
+    }
+    {
+        printColor(BGWHITE,
+            "\n├─ reserve relocates without copying elements\n");
+        ft::vector<t_buffer>    ftV;
+
+        for (int i = 0; i < 100; ++i) {
+            ftV.push_back(t_buffer(i));
+        }
+        t_buffer::copies = 0;
+        ftV.reserve(1000);
+        printStatus(!t_buffer::copies && *ftV[99].value == 99);
+    }
+    {
+        printColor(BGWHITE, "\n├─ insert and erase shift relocated elements\n");
+        ft::vector<t_buffer>    ftV;
+        std::vector<int>        stdV;
+
+        srand(42);
+        for (int i = 0; i < 2000; ++i) {
+            size_t  pos = rand() % (stdV.size() + 1);
+
+            if (rand() % 3 || stdV.empty()) {
+                ftV.insert(ftV.begin() + pos, 2, t_buffer(i));
+                stdV.insert(stdV.begin() + pos, 2, i);
+            } else if (pos < stdV.size()) {
+                ftV.erase(ftV.begin() + pos);
+                stdV.erase(stdV.begin() + pos);
+            }
+        }
+        ftV.erase(ftV.begin() + 10, ftV.begin() + 20);
+        stdV.erase(stdV.begin() + 10, stdV.begin() + 20);
+        ftV.insert(ftV.begin() + 1, ftV[5]);
+        stdV.insert(stdV.begin() + 1, stdV[5]);
+        printStatus(sameBuffers(ftV, stdV));
+    }
+    {
+        printColor(BGWHITE, "\n├─ insert and erase copy other types\n");
+        std::string             a[] = { "relocation", "is", "not", "allowed" };
+        ft::vector<std::string> ftV(a, a + 4);
+        std::vector<std::string> stdV(a, a + 4);
+
+        ftV.insert(ftV.begin() + 1, a, a + 4);
+        stdV.insert(stdV.begin() + 1, a, a + 4);
+        ftV.insert(ftV.begin(), 3, ftV.back());
+        stdV.insert(stdV.begin(), 3, stdV.back());
+        ftV.erase(ftV.begin() + 2, ftV.begin() + 5);
+        stdV.erase(stdV.begin() + 2, stdV.begin() + 5);
+        printStatus(compare_containers(ftV, stdV, compare<std::string>));
+    }
+}
+
+/* Pushes back n ints and collects each capacity the vector grew to. */
+template <typename Growth>
+static bool growthSteps(int n, std::vector<size_t>* steps) {
+    ft::vector<int, std::allocator<int>, Growth>    ftV;
+
+    for (int i = 0; i < n; ++i) {
+        ftV.push_back(i);
+        if (steps->empty() || steps->back() != ftV.capacity()) {
+            steps->push_back(ftV.capacity());
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        if (ftV[i] != i) {
+            return false;
+        }
+    }
+    return ftV.size() == static_cast<size_t>(n);
+}
+
+static void growthPolicyTest(void) {
+    printColor(CYAN, "\n[ GROWTH POLICY ]\n");
+    std::vector<size_t> steps;
+    bool                grows;
+
+    printColor(BGWHITE, "\n├─ growth_double\n");
+    grows = growthSteps<ft::growth_double>(10000, &steps);
+    for (size_t i = 1; i < steps.size(); ++i) {
+        grows = grows && steps[i] == steps[i - 1] * 2;
+    }
+    printStatus(grows && steps[0] == 1);
+
+    printColor(BGWHITE, "\n├─ growth_one_and_half\n");
+    steps.clear();
+    grows = growthSteps<ft::growth_one_and_half>(10000, &steps);
+    for (size_t i = 1; i < steps.size(); ++i) {
+        grows = grows && steps[i] == std::max(steps[i - 1] * 3 / 2,
+                                              steps[i - 1] + 1);
+    }
+    printStatus(grows);
+
+    printColor(BGWHITE, "\n├─ growth_page_rounded\n");
+    steps.clear();
+    grows = growthSteps<ft::growth_page_rounded<> >(10000, &steps);
+    for (size_t i = 1; i < steps.size(); ++i) {
+        size_t  bytes = steps[i] * sizeof(int);
+
+        grows = grows && steps[i] > steps[i - 1]
+                      && (bytes < ft::growth_page_size
+                          || bytes % ft::growth_page_size == 0);
+    }
+    printStatus(grows && steps.back() * sizeof(int) % 4096 == 0);
+
+    printColor(BGWHITE, "\n├─ growth_size_class\n");
+    steps.clear();
+    grows = growthSteps<ft::growth_size_class<> >(10000, &steps);
+    for (size_t i = 0; i < steps.size(); ++i) {
+        size_t  bytes = steps[i] * sizeof(int);
+        size_t  spacing = 16;
+
+        while (bytes > spacing * 8) {
+            spacing *= 2;
+        }
+        grows = grows && bytes % spacing == 0;
+    }
+    printStatus(grows && steps[0] * sizeof(int) == 16);
+}
+
 static void iteratorTest(void) {
     int a[] = { 1, 2, 3, 4, 5 };
     ft::vector<int>                     ftV(a, a + 5);
@@ -546,6 +698,27 @@ static void exceptionsTest(void) {
         accessorTestAux1(constV, 1);
         accessorTestAux2(constV, 1);
     }
+    {
+        printColor(BGWHITE, "\n├─ debug checks of iterators\n");
+        ft::vector<int>             v(5, 42);
+        ft::vector<int>             other(5, 42);
+        ft::vector<int>::iterator   stale = v.begin();
+
+        v.reserve(100);
+        eraseCheckTestAux(v, stale);
+        eraseCheckTestAux(v, other.begin());
+        eraseCheckTestAux(v, v.end());
+    }
+    {
+        printColor(BGWHITE, "\n├─ front() of an empty vector\n");
+        ft::vector<int> v;
+
+        try {
+            (void)v.front();
+            std::cerr << EXCEPT_MSG_08;
+            printStatus(false);
+        } catch (const std::logic_error& e) { printStatus(true); }
+    }
 
     printColor(BGWHITE, "\n├─ pushing back an element at its max_size\n");
     try {
@@ -18,6 +18,9 @@ struct integral_constant {
 typedef integral_constant<bool, true>     true_type;
 typedef integral_constant<bool, false>    false_type;
 
+template <typename T, typename U> struct is_same : public false_type {};
+template <typename T> struct is_same<T, T> : public true_type {};
+
 template <typename T> struct is_integral : public false_type {};
 
 template <> struct is_integral<bool> : public true_type {};
@@ -33,7 +36,53 @@ template <> struct is_integral<unsigned int> : public true_type {};
 template <> struct is_integral<unsigned long> : public true_type {};
 template <> struct is_integral<unsigned long long> : public true_type {};
 
-/** 
+/**
+ * Whether destroying a T can be skipped altogether. Relies on the compiler
+ * intrinsic where there is one, otherwise only integral types qualify.
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+template <typename T> struct is_trivially_destructible
+    : public integral_constant<bool, __has_trivial_destructor(T)> {};
+#else
+template <typename T> struct is_trivially_destructible
+    : public integral_constant<bool, is_integral<T>::value> {};
+#endif
+
+/**
+ * Whether a T can be copied byte for byte, as memcpy does: no user copy
+ * constructor, copy assignment or destructor anywhere in it. Without a
+ * compiler intrinsic, only integral and pointer types qualify.
+ */
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+template <typename T> struct is_trivially_copyable
+    : public integral_constant<bool, __is_trivially_copyable(T)> {};
+#elif defined(__GNUC__)
+template <typename T> struct is_trivially_copyable
+    : public integral_constant<bool, __has_trivial_copy(T)
+                                     && __has_trivial_assign(T)
+                                     && __has_trivial_destructor(T)> {};
+#else
+template <typename T> struct is_trivially_copyable
+    : public integral_constant<bool, is_integral<T>::value> {};
+template <typename T> struct is_trivially_copyable<T*> : public true_type {};
+#endif
+
+/**
+ * Whether moving a T to new storage can be a memmove of its bytes, with
+ * no copy construction nor destruction of the old T. Every trivially
+ * copyable type is. Types that own a resource through a pointer, but keep
+ * no pointer into themselves, may opt in with a specialization in
+ * namespace ft:
+ *
+ *     template <> struct is_trivially_relocatable<Buffer> : true_type {};
+ */
+
+template <typename T> struct is_trivially_relocatable
+    : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+/**
  * The type T is enabled as member type enable_if::type if Cond is true.
  * Otherwise, enable_if::type is not defined.
  */
@@ -44,6 +93,41 @@ struct enable_if {};
 template<class T>
 struct enable_if<true, T> { typedef T type; };
 
+/* conditional::type is T if Cond is true, F otherwise. */
+
+template <bool Cond, typename T, typename F>
+struct conditional { typedef T type; };
+
+template <typename T, typename F>
+struct conditional<false, T, F> { typedef F type; };
+
+/**
+ * Whether the comparator T declares an is_transparent member type, which
+ * lets associative containers search with anything it compares to a key.
+ */
+
+template <typename T>
+struct has_is_transparent {
+ private:
+    typedef char            yes;
+    struct no { char c[2]; };
+
+    template <typename U> static yes    test(typename U::is_transparent*);
+    template <typename U> static no     test(...);
+
+ public:
+    static const bool value = sizeof(test<T>(0)) == sizeof(yes);
+};
+
+/**
+ * enable_if for the heterogeneous lookup overloads. K is not used, but
+ * naming it delays the check until the member template is instantiated.
+ */
+
+template <typename Compare, typename K, typename T>
+struct enable_if_transparent
+    : public enable_if<has_is_transparent<Compare>::value, T> {};
+
 }   /* namespace ft */
 
 #endif  /* TYPE_TRAITS_TYPE_TRAITS_HPP_ */
@@ -0,0 +1,47 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef UTILITY_DEBUG_HPP_
+#define UTILITY_DEBUG_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Building with FT_DEBUG=1 checks the preconditions that the containers
+ * otherwise leave to the caller: indices below size(), front() and back()
+ * of a non-empty container, iterators that point into the container they
+ * are given to. An iterator left behind by a reallocation points outside
+ * the new storage, so most invalidated iterators are caught as well.
+ *
+ * A failed check calls FT_DEBUG_FAILURE(message), which prints it and
+ * aborts unless it is defined before the first include, for instance to
+ * throw an exception instead.
+ */
+
+#ifndef FT_DEBUG
+# define FT_DEBUG 0
+#endif
+
+namespace ft {
+
+inline void debug_failure(const char* file, int line, const char* message) {
+    std::fprintf(stderr, "%s:%d: debug check failed: %s\n",
+                 file, line, message);
+    std::abort();
+}
+
+}   /* namespace ft */
+
+#ifndef FT_DEBUG_FAILURE
+# define FT_DEBUG_FAILURE(message) \
+    ft::debug_failure(__FILE__, __LINE__, message)
+#endif
+
+#if FT_DEBUG
+# define FT_DEBUG_CHECK(cond, message) \
+    ((cond) ? static_cast<void>(0) : FT_DEBUG_FAILURE(message))
+#else
+# define FT_DEBUG_CHECK(cond, message) static_cast<void>(0)
+#endif
+
+#endif  /* UTILITY_DEBUG_HPP_ */
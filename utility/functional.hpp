@@ -0,0 +1,51 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef UTILITY_FUNCTIONAL_HPP_
+#define UTILITY_FUNCTIONAL_HPP_
+
+#include "./pair.hpp"
+
+namespace ft {
+
+/**
+ * Key extractors for rb_tree: a set's value is its own key, a map's key is
+ * the first member of the pair it stores.
+ */
+
+template <typename T>
+struct identity {
+    const T&    operator()(const T& x) const { return x; }
+};
+
+template <typename Pair>
+struct select_first {
+    const typename Pair::first_type&    operator()(const Pair& x) const {
+        return x.first;
+    }
+};
+
+/* The mapped value of a map element, or a set element itself. */
+struct select_mapped {
+    template <typename T1, typename T2>
+    const T2&   operator()(const ft::pair<T1, T2>& x) const { return x.second; }
+
+    template <typename T>
+    const T&    operator()(const T& x) const { return x; }
+};
+
+/**
+ * Less-than comparator that opts into heterogeneous lookups: any two types
+ * with an operator< between them can be compared, so a map with
+ * std::string keys can be searched with a const char* as it is.
+ */
+
+struct transparent_less {
+    typedef void    is_transparent;
+
+    template <typename T, typename U>
+    bool    operator()(const T& x, const U& y) const { return x < y; }
+};
+
+}   /* namespace ft */
+
+#endif  /* UTILITY_FUNCTIONAL_HPP_ */
@@ -0,0 +1,125 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef UTILITY_GROWTH_POLICY_HPP_
+#define UTILITY_GROWTH_POLICY_HPP_
+
+#include <cstddef>
+
+namespace ft {
+
+/**
+ * Growth policies of ft::vector and ft::small_vector: the capacity to
+ * reallocate to when an insertion does not fit. next_capacity gets the
+ * current capacity, the smallest one the insertion needs, the vector's
+ * max_size() and the size of an element, and returns at least required.
+ * Any class with such a static member function can be a policy.
+ */
+
+/* The capacity scaled by num / den, saturating at max_size. */
+inline std::size_t  scale_capacity(std::size_t capacity, std::size_t num,
+                                   std::size_t den, std::size_t max_size) {
+    if (capacity >= max_size / num) {
+        return max_size;
+    }
+    return capacity * num / den;
+}
+
+/* Rounds n elements up to whole blocks of granule bytes. */
+inline std::size_t  round_capacity(std::size_t n, std::size_t granule,
+                                   std::size_t value_size,
+                                   std::size_t max_size) {
+    std::size_t bytes = n * value_size;
+    std::size_t rounded = (bytes + granule - 1) / granule * granule;
+
+    if (rounded < bytes || rounded / value_size > max_size) {
+        return n;
+    }
+    return rounded / value_size;
+}
+
+/**
+ * Doubles the capacity, as std::vector does: the fewest reallocations,
+ * but no freed block is ever large enough for the next one.
+ */
+struct growth_double {
+    static std::size_t  next_capacity(std::size_t capacity,
+                                      std::size_t required,
+                                      std::size_t max_size,
+                                      std::size_t value_size) {
+        std::size_t grown = scale_capacity(capacity, 2, 1, max_size);
+
+        (void)value_size;
+        return grown < required ? required : grown;
+    }
+};  /* struct growth_double */
+
+/**
+ * Grows by half the capacity: after a few reallocations, the blocks freed
+ * before add up to the next one, which the allocator can then reuse.
+ */
+struct growth_one_and_half {
+    static std::size_t  next_capacity(std::size_t capacity,
+                                      std::size_t required,
+                                      std::size_t max_size,
+                                      std::size_t value_size) {
+        std::size_t grown = scale_capacity(capacity, 3, 2, max_size);
+
+        (void)value_size;
+        return grown < required ? required : grown;
+    }
+};  /* struct growth_one_and_half */
+
+const std::size_t   growth_page_size = 4096;
+
+/**
+ * Grows as Growth does, then fills the last page of blocks of a page or
+ * more, which are mapped whole anyway. Smaller ones are left as they are.
+ */
+template <typename Growth = growth_one_and_half>
+struct growth_page_rounded {
+    static std::size_t  next_capacity(std::size_t capacity,
+                                      std::size_t required,
+                                      std::size_t max_size,
+                                      std::size_t value_size) {
+        std::size_t grown = Growth::next_capacity(capacity, required,
+                                                  max_size, value_size);
+
+        if (grown * value_size < growth_page_size) {
+            return grown;
+        }
+        return round_capacity(grown, growth_page_size, value_size, max_size);
+    }
+};  /* struct growth_page_rounded */
+
+/**
+ * Grows as Growth does, then fills the size class of the block: malloc
+ * implementations such as jemalloc and tcmalloc serve a request with the
+ * smallest class that fits it, 16 bytes apart up to 128 bytes, then four
+ * classes per power of two. The rest of the class would be wasted.
+ */
+template <typename Growth = growth_one_and_half>
+struct growth_size_class {
+    static std::size_t  next_capacity(std::size_t capacity,
+                                      std::size_t required,
+                                      std::size_t max_size,
+                                      std::size_t value_size) {
+        std::size_t grown = Growth::next_capacity(capacity, required,
+                                                  max_size, value_size);
+        std::size_t bytes = grown * value_size;
+        std::size_t spacing = 16;
+
+        if (bytes > 128) {
+            std::size_t power = 128;
+
+            while (power < bytes - power) {
+                power <<= 1;
+            }
+            spacing = power >> 2;
+        }
+        return round_capacity(grown, spacing, value_size, max_size);
+    }
+};  /* struct growth_size_class */
+
+}   /* namespace ft */
+
+#endif  /* UTILITY_GROWTH_POLICY_HPP_ */
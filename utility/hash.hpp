@@ -0,0 +1,66 @@
+/* Copyright © 2022 Victor Nunes, Licensed under the MIT License. */
+
+#ifndef UTILITY_HASH_HPP_
+#define UTILITY_HASH_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace ft {
+
+/**
+ * Default hasher of the unordered containers. Only the types specialized
+ * below have one: any other key type needs a hasher of its own, passed as
+ * the Hash template parameter. Results need not be well mixed, the hash
+ * table scrambles them before use.
+ */
+
+template <typename T> struct hash;
+
+template <typename T>
+struct hash<T*> {
+    std::size_t operator()(T* x) const {
+        return reinterpret_cast<std::size_t>(x);
+    }
+};
+
+template <typename T>
+struct integral_hash {
+    std::size_t operator()(T x) const { return static_cast<std::size_t>(x); }
+};
+
+template <> struct hash<bool> : public integral_hash<bool> {};
+template <> struct hash<char> : public integral_hash<char> {};
+template <> struct hash<wchar_t> : public integral_hash<wchar_t> {};
+template <> struct hash<short> : public integral_hash<short> {};
+template <> struct hash<int> : public integral_hash<int> {};
+template <> struct hash<long> : public integral_hash<long> {};
+template <> struct hash<long long> : public integral_hash<long long> {};
+template <> struct hash<signed char> : public integral_hash<signed char> {};
+template <> struct hash<unsigned char>
+    : public integral_hash<unsigned char> {};
+template <> struct hash<unsigned short>
+    : public integral_hash<unsigned short> {};
+template <> struct hash<unsigned int> : public integral_hash<unsigned int> {};
+template <> struct hash<unsigned long>
+    : public integral_hash<unsigned long> {};
+template <> struct hash<unsigned long long>
+    : public integral_hash<unsigned long long> {};
+
+/* FNV-1a over the characters. */
+template <>
+struct hash<std::string> {
+    std::size_t operator()(const std::string& x) const {
+        std::size_t h = static_cast<std::size_t>(2166136261UL);
+
+        for (std::string::size_type i = 0; i < x.size(); ++i) {
+            h ^= static_cast<unsigned char>(x[i]);
+            h *= static_cast<std::size_t>(16777619UL);
+        }
+        return h;
+    }
+};
+
+}   /* namespace ft */
+
+#endif  /* UTILITY_HASH_HPP_ */
@@ -3,6 +3,8 @@
 #ifndef UTILITY_PAIR_HPP_
 #define UTILITY_PAIR_HPP_
 
+#include "../type_traits/type_traits.hpp"
+
 namespace ft {
 
 template <class T1, class T2>
@@ -20,8 +22,6 @@ struct pair {
 
     pair(const first_type& a, const second_type& b) : first(a), second(b) {}
 
-    ~pair() {}
-
     pair& operator= (const pair& pr) {
         first = pr.first;
         second = pr.second;
@@ -65,6 +65,12 @@ inline pair<T1, T2> make_pair(T1 x, T2 y) {
     return pair<T1, T2>(x, y);
 }
 
+/* A pair moves byte for byte whenever both of its members can. */
+template <class T1, class T2>
+struct is_trivially_relocatable<pair<T1, T2> >
+    : public integral_constant<bool, is_trivially_relocatable<T1>::value
+                                     && is_trivially_relocatable<T2>::value> {};
+
 }   /* namespace ft */
 
 #endif  /* UTILITY_PAIR_HPP_ */